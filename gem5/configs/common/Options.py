@@ -643,6 +643,15 @@ def addCommonOptions(parser, default_isa: Optional[ISA] = None):
         default=None,
         help="Number of instructions to fast forward before switching",
     )
+    parser.add_argument(
+        "--cache-warming-insts",
+        action="store",
+        type=int,
+        default=None,
+        help="""Record the accesses of the last <N> fast-forwarded
+                instructions in tag-only cache models, and install the
+                resulting blocks in the caches before switching.""",
+    )
     parser.add_argument(
         "-S",
         "--simpoint",
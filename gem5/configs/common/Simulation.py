@@ -471,6 +471,30 @@ def repeatSwitch(testsys, repeat_switch_cpu_list, maxtick, switch_freq):
             return exit_event
 
 
+def warmCaches(testsys, insts):
+    """Keep fast-forwarding for insts more instructions while recording the
+    accesses in tag-only models of the caches, and then install the
+    recorded blocks in the caches so that they are warm when switching."""
+    caches = [
+        obj for obj in testsys.descendants() if isinstance(obj, BaseCache)
+    ]
+    # Fill the shared caches before the private ones, so that the fills of
+    # the latter find their blocks in the former
+    caches.sort(key=lambda cache: isinstance(cache.get_parent(), BaseCPU))
+
+    for cache in caches:
+        cache.startWarming()
+    for cpu in testsys.cpu:
+        cpu.scheduleInstStop(0, insts, "cache warming complete")
+
+    print(f"Warming caches up for {insts} instructions")
+    exit_event = m5.simulate()
+    for cache in caches:
+        cache.stopWarming()
+
+    return exit_event
+
+
 def run(options, root, testsys, cpu_class):
     if options.checkpoint_dir:
         cptdir = options.checkpoint_dir
@@ -491,6 +515,15 @@ def run(options, root, testsys, cpu_class):
     if options.repeat_switch and options.take_checkpoints:
         fatal("Can't specify both --repeat-switch and --take-checkpoints")
 
+    if options.cache_warming_insts:
+        if not (cpu_class and options.fast_forward and options.caches):
+            fatal(
+                "--cache-warming-insts requires --fast-forward and --caches"
+                " with a CPU switch"
+            )
+        if options.cache_warming_insts > int(options.fast_forward):
+            fatal("Can't warm caches up for longer than --fast-forward")
+
     # Setup global stat filtering.
     stat_root_simobjs = []
     for stat_root_str in options.stats_root:
@@ -522,7 +555,11 @@ def run(options, root, testsys, cpu_class):
 
         for i in range(np):
             if options.fast_forward:
-                testsys.cpu[i].max_insts_any_thread = int(options.fast_forward)
+                ff_insts = int(options.fast_forward)
+                # the last instructions are run while warming the caches
+                if options.cache_warming_insts:
+                    ff_insts -= options.cache_warming_insts
+                testsys.cpu[i].max_insts_any_thread = ff_insts
             switch_cpus[i].system = testsys
             switch_cpus[i].workload = testsys.cpu[i].workload
             switch_cpus[i].clk_domain = testsys.cpu[i].clk_domain
@@ -747,6 +784,8 @@ def run(options, root, testsys, cpu_class):
                 % str(testsys.cpu[0].max_insts_any_thread)
             )
             exit_event = m5.simulate()
+            if options.cache_warming_insts:
+                exit_event = warmCaches(testsys, options.cache_warming_insts)
         else:
             print(f"Switch at curTick count:{str(10000)}")
             exit_event = m5.simulate(10000)
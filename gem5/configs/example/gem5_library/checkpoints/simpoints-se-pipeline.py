@@ -0,0 +1,186 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+This configuration script shows how to go from a binary to a SimPoint
+estimate of its performance in one go with the gem5 stdlib:
+
+1. Profile: run the whole program on an atomic CPU with the SimPoint probe,
+   which records a basic block vector (BBV) every ``--interval``
+   instructions.
+2. Cluster: pick the SimPoints and their weights from the BBVs with
+   ``gem5.utils.bbv_clustering``.
+3. Checkpoint: run the program again, taking a checkpoint ahead of each
+   SimPoint, leaving room for ``--warmup`` instructions of warmup.
+4. Simulate: restore each checkpoint on a detailed board, warm up, reset the
+   stats and simulate the SimPoint. These runs are done in parallel, with up
+   to ``--processes`` gem5 processes.
+5. Merge: weigh the stats of the SimPoint runs with
+   ``gem5.utils.weighted_stats``.
+
+Every step writes into its own sub-directory of the output directory. The
+estimate for the whole program is written to ``weighted_stats.txt``.
+
+Usage
+-----
+
+```
+scons build/X86/gem5.opt
+./build/X86/gem5.opt \
+    configs/example/gem5_library/checkpoints/simpoints-se-pipeline.py
+```
+"""
+
+import argparse
+from pathlib import Path
+
+import m5
+from m5.util import fatal
+
+from gem5.isas import ISA
+from gem5.resources.resource import SimpointResource
+from gem5.utils.bbv_clustering import (
+    find_simpoints,
+    read_bbv,
+    write_simpoints,
+)
+from gem5.utils.multiprocessing import (
+    Pool,
+    Process,
+)
+from gem5.utils.requires import requires
+from gem5.utils.weighted_stats import (
+    merge_stats,
+    read_stats,
+    write_stats,
+)
+
+from simpoints_se_pipeline_steps import (
+    checkpoint,
+    profile,
+    simulate_job,
+)
+
+requires(isa_required=ISA.X86)
+
+
+def _run(target, *args) -> None:
+    # Each step instantiates a simulation, so it needs a gem5 process of its
+    # own.
+    process = Process(target=target, args=args)
+    process.start()
+    process.join()
+    if process.exitcode != 0:
+        fatal(f"{target.__name__} failed with exit code {process.exitcode}")
+
+
+if __name__ == "__m5_main__" or __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Estimate the performance of a workload with SimPoints."
+    )
+    parser.add_argument(
+        "--interval",
+        type=int,
+        default=1000000,
+        help="The length of the SimPoints, in instructions.",
+    )
+    parser.add_argument(
+        "--warmup",
+        type=int,
+        default=1000000,
+        help="The number of instructions to warm up with before a SimPoint.",
+    )
+    parser.add_argument(
+        "--max-k",
+        type=int,
+        default=10,
+        help="The maximum number of SimPoints.",
+    )
+    parser.add_argument(
+        "--processes",
+        type=int,
+        default=4,
+        help="The number of SimPoints simulated in parallel.",
+    )
+    args = parser.parse_args()
+
+    outdir = Path(m5.options.outdir)
+
+    print("Profiling the workload")
+    _run(profile, outdir / "profile", args.interval)
+
+    print("Picking SimPoints")
+    simpoint_list, weight_list = find_simpoints(
+        read_bbv((outdir / "profile" / "simpoint.bb.gz").as_posix()),
+        max_k=args.max_k,
+    )
+    write_simpoints(
+        simpoint_list,
+        weight_list,
+        (outdir / "simpoints.txt").as_posix(),
+        (outdir / "weights.txt").as_posix(),
+    )
+
+    print(f"Taking checkpoints for SimPoints {simpoint_list}")
+    _run(
+        checkpoint,
+        outdir / "checkpoints",
+        SimpointResource(
+            simpoint_interval=args.interval,
+            simpoint_list=simpoint_list,
+            weight_list=weight_list,
+            warmup_interval=args.warmup,
+        ),
+    )
+
+    print("Simulating SimPoints")
+    jobs = [
+        (
+            outdir / f"simpoint{i}",
+            outdir / "checkpoints" / f"cpt.SimPoint{i}",
+            SimpointResource(
+                simpoint_interval=args.interval,
+                simpoint_list=[simpoint],
+                weight_list=[weight],
+                warmup_interval=args.warmup,
+            ),
+        )
+        for i, (simpoint, weight) in enumerate(zip(simpoint_list, weight_list))
+    ]
+    with Pool(processes=args.processes, maxtasksperchild=1) as pool:
+        pool.map(simulate_job, jobs)
+
+    write_stats(
+        merge_stats(
+            [
+                read_stats((outdir / f"simpoint{i}" / "stats.txt").as_posix())
+                for i in range(len(jobs))
+            ],
+            weight_list,
+        ),
+        (outdir / "weighted_stats.txt").as_posix(),
+    )
+    print(f"Wrote the estimate to {outdir / 'weighted_stats.txt'}")
@@ -0,0 +1,157 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+The steps of configs/example/gem5_library/checkpoints/simpoints-se-pipeline.py
+which need a gem5 process of their own. They live in a module so the
+processes spawned by ``gem5.utils.multiprocessing`` can import them.
+"""
+
+from pathlib import Path
+
+from m5.stats import (
+    dump,
+    reset,
+)
+
+from gem5.components.boards.simple_board import SimpleBoard
+from gem5.components.cachehierarchies.classic.no_cache import NoCache
+from gem5.components.cachehierarchies.classic.private_l1_private_l2_walk_cache_hierarchy import (
+    PrivateL1PrivateL2WalkCacheHierarchy,
+)
+from gem5.components.memory import DualChannelDDR4_2400
+from gem5.components.memory.single_channel import SingleChannelDDR3_1600
+from gem5.components.processors.cpu_types import CPUTypes
+from gem5.components.processors.simple_processor import SimpleProcessor
+from gem5.isas import ISA
+from gem5.resources.resource import (
+    SimpointResource,
+    obtain_resource,
+)
+from gem5.simulate.exit_event import ExitEvent
+from gem5.simulate.exit_event_generators import (
+    simpoints_save_checkpoint_generator,
+)
+from gem5.simulate.simulator import Simulator
+
+# The workload to analyze.
+BINARY = "x86-print-this"
+ARGUMENTS = ["print this", 15000]
+
+
+def atomic_board() -> SimpleBoard:
+    # As in simpoints-se-checkpoint.py, no caches and a simple memory make
+    # the profiling and checkpointing runs fast. Only the memory size has to
+    # match the detailed board.
+    return SimpleBoard(
+        clk_freq="3GHz",
+        processor=SimpleProcessor(
+            cpu_type=CPUTypes.ATOMIC, isa=ISA.X86, num_cores=1
+        ),
+        memory=SingleChannelDDR3_1600(size="2GB"),
+        cache_hierarchy=NoCache(),
+    )
+
+
+def detailed_board() -> SimpleBoard:
+    return SimpleBoard(
+        clk_freq="3GHz",
+        processor=SimpleProcessor(
+            cpu_type=CPUTypes.TIMING, isa=ISA.X86, num_cores=1
+        ),
+        memory=DualChannelDDR4_2400(size="2GB"),
+        cache_hierarchy=PrivateL1PrivateL2WalkCacheHierarchy(
+            l1d_size="32kB", l1i_size="32kB", l2_size="256kB"
+        ),
+    )
+
+
+def profile(outdir: Path, interval: int) -> None:
+    board = atomic_board()
+    board.set_se_binary_workload(
+        binary=obtain_resource(BINARY), arguments=ARGUMENTS
+    )
+    for core in board.get_processor().get_cores():
+        core.get_simobject().addSimPointProbe(interval)
+
+    simulator = Simulator(board=board)
+    simulator.override_outdir(outdir)
+    simulator.run()
+
+
+def checkpoint(outdir: Path, simpoint: SimpointResource) -> None:
+    board = atomic_board()
+    board.set_se_simpoint_workload(
+        binary=obtain_resource(BINARY),
+        arguments=ARGUMENTS,
+        simpoint=simpoint,
+    )
+
+    simulator = Simulator(
+        board=board,
+        on_exit_event={
+            ExitEvent.SIMPOINT_BEGIN: simpoints_save_checkpoint_generator(
+                outdir, simpoint
+            )
+        },
+    )
+    simulator.override_outdir(outdir)
+    simulator.run()
+
+
+def simulate(
+    outdir: Path, checkpoint_dir: Path, simpoint: SimpointResource
+) -> None:
+    board = detailed_board()
+    board.set_se_simpoint_workload(
+        binary=obtain_resource(BINARY),
+        arguments=ARGUMENTS,
+        simpoint=simpoint,
+        checkpoint=checkpoint_dir,
+    )
+    interval = simpoint.get_simpoint_interval()
+    warmup = simpoint.get_warmup_list()[0]
+
+    def max_inst():
+        # The first exit is the end of the warmup, unless there is none.
+        if warmup:
+            simulator.schedule_max_insts(interval)
+            dump()
+            reset()
+            yield False
+        yield True
+
+    simulator = Simulator(
+        board=board, on_exit_event={ExitEvent.MAX_INSTS: max_inst()}
+    )
+    simulator.override_outdir(outdir)
+    simulator.schedule_max_insts(warmup if warmup else interval)
+    simulator.run()
+
+
+def simulate_job(args) -> None:
+    """``simulate`` taking its arguments as one tuple, for ``Pool.map``."""
+    simulate(*args)
@@ -116,6 +116,23 @@ def define_options(parser):
         default=50000,
         help="network-level deadlock threshold.",
     )
+    parser.add_argument(
+        "--garnet-analytic",
+        action="store_true",
+        default=False,
+        help="""use an analytic latency model in garnet instead of
+            simulating the routers.""",
+    )
+    parser.add_argument(
+        "--garnet-threads",
+        action="store",
+        type=int,
+        default=0,
+        help="""number of host threads used to simulate the garnet
+            routers in lock-step. Results are the same for any number of
+            threads, but differ from the default event-driven simulation
+            of the routers (0).""",
+    )
     parser.add_argument(
         "--simple-physical-channels",
         action="store_true",
@@ -172,6 +189,8 @@ def init_network(options, network, InterfaceClass):
         network.ni_flit_size = options.link_width_bits / 8
         network.routing_algorithm = options.routing_algorithm
         network.garnet_deadlock_threshold = options.garnet_deadlock_threshold
+        network.num_threads = options.garnet_threads
+        network.analytic_model = options.garnet_analytic
 
         # Create Bridges and connect them to the corresponding links
         for intLink in network.int_links:
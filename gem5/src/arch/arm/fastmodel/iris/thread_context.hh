@@ -229,6 +229,14 @@ class ThreadContext : public gem5::ThreadContext
 
     void sendFunctional(PacketPtr pkt) override;
 
+    void
+    sendMemBackdoorReq(const MemBackdoorReq &req,
+                       MemBackdoorPtr &backdoor) override
+    {
+        // Memory accesses go through Iris, which doesn't expose pointers
+        // into the model's memory.
+    }
+
     Process *
     getProcessPtr() override
     {
@@ -104,7 +104,13 @@ class InfoProxy : public Base
     InfoProxy(Stat &stat) : s(stat) {}
 
     bool check() const { return s.check(); }
-    void prepare() { s.prepare(); }
+    void
+    prepare()
+    {
+        s.prepare();
+        this->changed = s.isDirty();
+    }
+    void clearDirty() { s.clearDirty(); }
     void reset() { s.reset(); }
     void
     visit(Output &visitor)
@@ -215,6 +221,18 @@ class InfoAccess
      */
     bool zero() const { return true; }
 
+    /**
+     * @return true if this stat may have been modified since the last
+     * call to clearDirty(). Stats that don't track their modifications
+     * are always dirty.
+     */
+    bool isDirty() const { return true; }
+
+    /**
+     * Start tracking modifications from the current state of the stat.
+     */
+    void clearDirty() { }
+
     /**
      * Check that this stat has been set up properly and is ready for
      * use
@@ -626,6 +644,9 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
 
     bool zero() const { return result() == 0.0; }
 
+    bool isDirty() const { return data()->isDirty(); }
+    void clearDirty() { data()->clearDirty(); }
+
     void reset() { data()->reset(this->info()->getStorageParams()); }
     void prepare() { data()->prepare(this->info()->getStorageParams()); }
 };
@@ -1009,6 +1030,22 @@ class VectorBase : public DataWrapVec<Derived, VectorInfoProxy>
         return true;
     }
 
+    bool
+    isDirty() const
+    {
+        for (off_type i = 0; i < size(); ++i)
+            if (data(i)->isDirty())
+                return true;
+        return false;
+    }
+
+    void
+    clearDirty()
+    {
+        for (off_type i = 0; i < size(); ++i)
+            data(i)->clearDirty();
+    }
+
     bool
     check() const
     {
@@ -1213,6 +1250,22 @@ class Vector2dBase : public DataWrapVec2d<Derived, Vector2dInfoProxy>
         return data(0)->zero();
     }
 
+    bool
+    isDirty() const
+    {
+        for (off_type i = 0; i < size(); ++i)
+            if (data(i)->isDirty())
+                return true;
+        return false;
+    }
+
+    void
+    clearDirty()
+    {
+        for (off_type i = 0; i < size(); ++i)
+            data(i)->clearDirty();
+    }
+
     /**
      * Return a total of all entries in this vector.
      * @return The total of all vector entries.
@@ -1337,6 +1390,9 @@ class DistBase : public DataWrap<Derived, DistInfoProxy>
      */
     bool zero() const { return data()->zero(); }
 
+    bool isDirty() const { return data()->isDirty(); }
+    void clearDirty() { data()->clearDirty(); }
+
     void
     prepare()
     {
@@ -1438,6 +1494,22 @@ class VectorDistBase : public DataWrapVec<Derived, VectorDistInfoProxy>
         return true;
     }
 
+    bool
+    isDirty() const
+    {
+        for (off_type i = 0; i < size(); ++i)
+            if (data(i)->isDirty())
+                return true;
+        return false;
+    }
+
+    void
+    clearDirty()
+    {
+        for (off_type i = 0; i < size(); ++i)
+            data(i)->clearDirty();
+    }
+
     void
     prepare()
     {
@@ -2118,6 +2190,111 @@ class Distribution : public DistBase<Distribution, DistStor>
     }
 };
 
+/**
+ * A scalar stat that can be updated concurrently by the threads of a
+ * parallel simulation without sharing cache lines.
+ * @sa Stat, ScalarBase, ShardedStatStor
+ */
+class ShardedScalar : public ScalarBase<ShardedScalar, ShardedStatStor>
+{
+  public:
+    using ScalarBase<ShardedScalar, ShardedStatStor>::operator=;
+
+    ShardedScalar(Group *parent = nullptr)
+        : ScalarBase<ShardedScalar, ShardedStatStor>(
+                parent, nullptr, units::Unspecified::get(), nullptr)
+    {
+    }
+
+    ShardedScalar(Group *parent, const char *name,
+                  const char *desc = nullptr)
+        : ScalarBase<ShardedScalar, ShardedStatStor>(
+                parent, name, units::Unspecified::get(), desc)
+    {
+    }
+
+    ShardedScalar(Group *parent, const char *name, const units::Base *unit,
+                  const char *desc = nullptr)
+        : ScalarBase<ShardedScalar, ShardedStatStor>(parent, name, unit, desc)
+    {
+    }
+};
+
+/**
+ * A vector of scalar stats that can be updated concurrently by the
+ * threads of a parallel simulation.
+ * @sa Stat, VectorBase, ShardedStatStor
+ */
+class ShardedVector : public VectorBase<ShardedVector, ShardedStatStor>
+{
+  public:
+    ShardedVector(Group *parent = nullptr)
+        : VectorBase<ShardedVector, ShardedStatStor>(
+                parent, nullptr, units::Unspecified::get(), nullptr)
+    {
+    }
+
+    ShardedVector(Group *parent, const char *name,
+                  const char *desc = nullptr)
+        : VectorBase<ShardedVector, ShardedStatStor>(
+                parent, name, units::Unspecified::get(), desc)
+    {
+    }
+
+    ShardedVector(Group *parent, const char *name, const units::Base *unit,
+                  const char *desc = nullptr)
+        : VectorBase<ShardedVector, ShardedStatStor>(parent, name, unit, desc)
+    {
+    }
+};
+
+/**
+ * A distribution stat that can be sampled concurrently by the threads
+ * of a parallel simulation.
+ * @sa Stat, DistBase, ShardedDistStor
+ */
+class ShardedDistribution
+    : public DistBase<ShardedDistribution, ShardedDistStor>
+{
+  public:
+    ShardedDistribution(Group *parent = nullptr)
+        : DistBase<ShardedDistribution, ShardedDistStor>(
+                parent, nullptr, units::Unspecified::get(), nullptr)
+    {
+    }
+
+    ShardedDistribution(Group *parent, const char *name,
+                        const char *desc = nullptr)
+        : DistBase<ShardedDistribution, ShardedDistStor>(
+                parent, name, units::Unspecified::get(), desc)
+    {
+    }
+
+    ShardedDistribution(Group *parent, const char *name,
+                        const units::Base *unit, const char *desc = nullptr)
+        : DistBase<ShardedDistribution, ShardedDistStor>(
+                parent, name, unit, desc)
+    {
+    }
+
+    /**
+     * Set the parameters of this distribution. @sa DistStor::Params
+     * @param min The minimum value of the distribution.
+     * @param max The maximum value of the distribution.
+     * @param bkt The number of values in each bucket.
+     * @return A reference to this distribution.
+     */
+    ShardedDistribution &
+    init(Counter min, Counter max, Counter bkt)
+    {
+        ShardedDistStor::Params *params =
+            new ShardedDistStor::Params(min, max, bkt);
+        this->setParams(params);
+        this->doInit();
+        return this->self();
+    }
+};
+
 /**
  * A simple histogram stat.
  * @sa Stat, DistBase, HistStor
@@ -2474,6 +2651,9 @@ class SparseHistBase : public DataWrap<Derived, SparseHistInfoProxy>
      */
     bool zero() const { return data()->zero(); }
 
+    bool isDirty() const { return data()->isDirty(); }
+    void clearDirty() { data()->clearDirty(); }
+
     void
     prepare()
     {
@@ -2699,6 +2879,14 @@ class Temp
         : node(new ScalarStatNode(s.info()))
     { }
 
+    /**
+     * Create a new ScalarStatNode.
+     * @param s The ScalarStat to place in a node.
+     */
+    Temp(const ShardedScalar &s)
+        : node(new ScalarStatNode(s.info()))
+    { }
+
     /**
      * Create a new VectorStatNode.
      * @param s The VectorStat to place in a node.
@@ -2711,6 +2899,10 @@ class Temp
         : node(new VectorStatNode(s.info()))
     { }
 
+    Temp(const ShardedVector &s)
+        : node(new VectorStatNode(s.info()))
+    { }
+
     /**
      *
      */
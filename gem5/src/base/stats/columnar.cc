@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/columnar.hh"
+
+#include <zlib.h>
+
+#include <cassert>
+#include <cstring>
+
+#include "base/logging.hh"
+#include "base/stats/info.hh"
+#include "sim/byteswap.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+const char columnarMagic[8] = { 'g', 'e', 'm', '5', 'c', 'o', 'l', '\1' };
+
+/** Number of values a distribution contributes besides its buckets. */
+constexpr uint32_t distFields = 9;
+
+const char *distFieldNames[distFields] = {
+    "samples", "sum", "squares", "min_value", "max_value",
+    "underflows", "overflows", "bucket_min", "bucket_size",
+};
+
+template <typename T>
+void
+put(std::vector<uint8_t> &buf, T value)
+{
+    value = htole(value);
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+    buf.insert(buf.end(), bytes, bytes + sizeof(value));
+}
+
+void
+putString(std::vector<uint8_t> &buf, const std::string &str)
+{
+    put<uint32_t>(buf, str.size());
+    buf.insert(buf.end(), str.begin(), str.end());
+}
+
+std::string
+vectorLabel(const std::vector<std::string> &subnames, size_t i)
+{
+    if (i < subnames.size() && !subnames[i].empty())
+        return subnames[i];
+    return std::to_string(i);
+}
+
+} // anonymous namespace
+
+Columnar::Columnar(const std::string &file_name, bool delta,
+                   int compression, bool desc, bool formulas)
+    : file(simout.create(file_name, true, true)),
+      enableDelta(delta), compressionLevel(compression),
+      enableDescriptions(desc), enableFormula(formulas),
+      haveSchema(false)
+{
+    fatal_if(compression < 0 || compression > 9,
+             "Invalid stats compression level %i, expected 0-9.\n",
+             compression);
+
+    file->stream()->write(columnarMagic, sizeof(columnarMagic));
+}
+
+Columnar::~Columnar()
+{
+    simout.close(file);
+}
+
+void
+Columnar::begin()
+{
+    groups.assign(1, "");
+    groupStack.assign(1, 0);
+    entries.clear();
+    values.clear();
+}
+
+void
+Columnar::end()
+{
+    assert(valid());
+
+    if (!haveSchema || entries != schemaEntries || groups != schemaGroups)
+        writeSchema();
+
+    writeFrame();
+    file->stream()->flush();
+}
+
+bool
+Columnar::valid() const
+{
+    return file && file->stream()->good();
+}
+
+void
+Columnar::beginGroup(const char *name)
+{
+    const std::string &parent = groups[groupStack.back()];
+    groupStack.push_back(groups.size());
+    groups.push_back(parent.empty() ? name : parent + "." + name);
+}
+
+void
+Columnar::endGroup()
+{
+    assert(groupStack.size() > 1);
+    groupStack.pop_back();
+}
+
+bool
+Columnar::noOutput(const Info &info) const
+{
+    // Unlike the text output, stats whose prerequisite is zero are
+    // still dumped to keep the frame layout stable between dumps.
+    return !info.flags.isSet(display);
+}
+
+void
+Columnar::addEntry(const Info &info, StatKind kind, uint32_t size)
+{
+    entries.push_back(Entry{ &info, kind, groupStack.back(), size });
+}
+
+void
+Columnar::appendDist(const DistData &data)
+{
+    values.push_back(data.samples);
+    values.push_back(data.sum);
+    values.push_back(data.squares);
+    values.push_back(data.min_val);
+    values.push_back(data.max_val);
+    values.push_back(data.underflow);
+    values.push_back(data.overflow);
+    values.push_back(data.min);
+    values.push_back(data.bucket_size);
+    values.insert(values.end(), data.cvec.begin(), data.cvec.end());
+}
+
+void
+Columnar::visit(const ScalarInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    addEntry(info, ScalarKind, 1);
+    values.push_back(info.result());
+}
+
+void
+Columnar::visit(const VectorInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    const VResult &vr = info.result();
+    addEntry(info, VectorKind, vr.size());
+    values.insert(values.end(), vr.begin(), vr.end());
+}
+
+void
+Columnar::visit(const DistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    addEntry(info, DistKind, distFields + info.data.cvec.size());
+    appendDist(info.data);
+}
+
+void
+Columnar::visit(const VectorDistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    const size_t start = values.size();
+    for (const auto &data : info.data)
+        appendDist(data);
+    addEntry(info, VectorDistKind, values.size() - start);
+}
+
+void
+Columnar::visit(const Vector2dInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    addEntry(info, Vector2dKind, info.cvec.size());
+    values.insert(values.end(), info.cvec.begin(), info.cvec.end());
+}
+
+void
+Columnar::visit(const FormulaInfo &info)
+{
+    if (!enableFormula || noOutput(info))
+        return;
+
+    const VResult &vr = info.result();
+    addEntry(info, FormulaKind, vr.size());
+    values.insert(values.end(), vr.begin(), vr.end());
+}
+
+void
+Columnar::visit(const SparseHistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    // The set of sampled values changes over time, which doesn't fit
+    // a fixed frame layout.
+    warn_once("Columnar stat files only store the number of samples of "
+              "sparse histograms.\n");
+    addEntry(info, SparseHistKind, 1);
+    values.push_back(info.data.samples);
+}
+
+void
+Columnar::entryLabels(const Entry &entry,
+                      std::vector<std::string> &labels) const
+{
+    labels.clear();
+
+    auto dist_labels = [&labels](const std::string &prefix, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            labels.push_back(prefix + (i < distFields ?
+                std::string(distFieldNames[i]) :
+                std::to_string(i - distFields)));
+        }
+    };
+
+    switch (entry.kind) {
+      case ScalarKind:
+        labels.emplace_back();
+        break;
+      case VectorKind:
+      case FormulaKind: {
+          const auto &info = static_cast<const VectorInfo &>(*entry.info);
+          // Single element vectors, e.g., most formulas, are named
+          // like scalars.
+          if (entry.size == 1 &&
+              (info.subnames.empty() || info.subnames[0].empty())) {
+              labels.emplace_back();
+              break;
+          }
+          for (size_t i = 0; i < entry.size; ++i)
+              labels.push_back(vectorLabel(info.subnames, i));
+        }
+        break;
+      case DistKind:
+        dist_labels("", entry.size);
+        break;
+      case VectorDistKind: {
+          const auto &info =
+              static_cast<const VectorDistInfo &>(*entry.info);
+          for (size_t i = 0; i < info.data.size(); ++i) {
+              dist_labels(vectorLabel(info.subnames, i) + "::",
+                          distFields + info.data[i].cvec.size());
+          }
+        }
+        break;
+      case Vector2dKind: {
+          const auto &info = static_cast<const Vector2dInfo &>(*entry.info);
+          for (size_t x = 0; x < info.x; ++x) {
+              for (size_t y = 0; y < info.y; ++y) {
+                  labels.push_back(vectorLabel(info.subnames, x) + "::" +
+                                   vectorLabel(info.y_subnames, y));
+              }
+          }
+        }
+        break;
+      case SparseHistKind:
+        labels.emplace_back("samples");
+        break;
+    }
+
+    assert(labels.size() == entry.size);
+}
+
+void
+Columnar::writeSchema()
+{
+    std::vector<uint8_t> payload;
+    std::vector<std::string> labels;
+
+    put<uint32_t>(payload, entries.size());
+    for (const auto &entry : entries) {
+        const std::string &group = groups[entry.group];
+        put<uint8_t>(payload, entry.kind);
+        put<uint32_t>(payload, entry.size);
+        putString(payload, group.empty() ?
+                  entry.info->name : group + "." + entry.info->name);
+        putString(payload, enableDescriptions ? entry.info->desc : "");
+
+        entryLabels(entry, labels);
+        for (const auto &label : labels)
+            putString(payload, label);
+    }
+
+    writeRecord(SchemaRecord, 0, payload);
+
+    schemaGroups = groups;
+    schemaEntries = entries;
+    haveSchema = true;
+
+    // The next frame starts a new layout and can't be XOR-encoded
+    // against the previous one.
+    lastFrame.clear();
+}
+
+void
+Columnar::writeFrame()
+{
+    std::vector<uint8_t> payload;
+    payload.reserve(sizeof(uint64_t) * (values.size() + 1));
+
+    const bool delta = enableDelta && lastFrame.size() == values.size();
+    lastFrame.resize(values.size());
+
+    put<uint64_t>(payload, curTick());
+    for (size_t i = 0; i < values.size(); ++i) {
+        uint64_t bits;
+        std::memcpy(&bits, &values[i], sizeof(bits));
+        put<uint64_t>(payload, delta ? bits ^ lastFrame[i] : bits);
+        lastFrame[i] = bits;
+    }
+
+    writeRecord(FrameRecord, delta ? XorDelta : 0, payload);
+}
+
+void
+Columnar::writeRecord(RecordType type, uint32_t flags,
+                      const std::vector<uint8_t> &payload)
+{
+    const std::vector<uint8_t> *data = &payload;
+    std::vector<uint8_t> compressed;
+
+    if (compressionLevel > 0) {
+        uLongf size = compressBound(payload.size());
+        compressed.resize(size);
+        int ret = compress2(compressed.data(), &size, payload.data(),
+                            payload.size(), compressionLevel);
+        panic_if(ret != Z_OK, "Failed to compress stats record: %i\n", ret);
+        compressed.resize(size);
+        data = &compressed;
+        flags |= Deflate;
+    }
+
+    std::vector<uint8_t> header;
+    put<uint32_t>(header, type);
+    put<uint32_t>(header, flags);
+    put<uint64_t>(header, payload.size());
+    put<uint64_t>(header, data->size());
+
+    std::ostream &os = *file->stream();
+    os.write(reinterpret_cast<const char *>(header.data()), header.size());
+    os.write(reinterpret_cast<const char *>(data->data()), data->size());
+}
+
+std::unique_ptr<Output>
+initColumnar(const std::string &filename, bool delta, int compression,
+             bool desc, bool formulas)
+{
+    return std::unique_ptr<Output>(
+        new Columnar(filename, delta, compression, desc, formulas));
+}
+
+} // namespace statistics
+} // namespace gem5
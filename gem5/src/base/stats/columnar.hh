@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_COLUMNAR_HH__
+#define __BASE_STATS_COLUMNAR_HH__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/output.hh"
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+/**
+ * Compact binary stat output designed for frequent periodic dumps.
+ *
+ * The file is a sequence of records. A schema record lists every
+ * stat that is dumped together with the labels of its values, and
+ * is only written for the first dump and whenever the set of dumped
+ * stats changes. Every dump then appends a frame record holding the
+ * current tick and one double per value, in schema order. Frames can
+ * be XOR-encoded against the previous frame, which turns unchanged
+ * values into zero words, and deflated with zlib.
+ *
+ * All integers and doubles are stored in little endian. The file
+ * starts with the 8 byte magic "gem5col\1" and each record starts
+ * with a header of four little endian fields: type (uint32), flags
+ * (uint32), decoded payload size (uint64) and stored payload size
+ * (uint64). See m5.stats.columnar for a reader.
+ */
+class Columnar : public Output
+{
+  public:
+    /**
+     * @param file Name of the output file in the output directory.
+     * @param delta XOR-encode each frame against the previous one.
+     * @param compression zlib compression level, 0 disables it.
+     * @param desc Include stat descriptions in the schema.
+     * @param formulas Output derived stats.
+     */
+    Columnar(const std::string &file, bool delta, int compression,
+             bool desc, bool formulas);
+
+    ~Columnar();
+
+    Columnar() = delete;
+    Columnar(const Columnar &other) = delete;
+
+  public: // Output interface
+    void begin() override;
+    void end() override;
+    bool valid() const override;
+
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+  protected:
+    enum RecordType : uint32_t
+    {
+        SchemaRecord = 1,
+        FrameRecord = 2,
+    };
+
+    enum RecordFlags : uint32_t
+    {
+        XorDelta = 0x1,
+        Deflate = 0x2,
+    };
+
+    enum StatKind : uint8_t
+    {
+        ScalarKind = 0,
+        VectorKind,
+        DistKind,
+        VectorDistKind,
+        Vector2dKind,
+        FormulaKind,
+        SparseHistKind,
+    };
+
+    /** A stat that was visited during a dump. */
+    struct Entry
+    {
+        const Info *info;
+        StatKind kind;
+        /** Index of the group the stat was visited in. */
+        uint32_t group;
+        /** Number of values the stat contributed to the frame. */
+        uint32_t size;
+
+        bool
+        operator==(const Entry &other) const
+        {
+            return info == other.info && kind == other.kind &&
+                group == other.group && size == other.size;
+        }
+    };
+
+    /** Skip stats that are not meant to be displayed. */
+    bool noOutput(const Info &info) const;
+
+    void addEntry(const Info &info, StatKind kind, uint32_t size);
+    void appendDist(const DistData &data);
+
+    /** Build the labels of the values contributed by a stat. */
+    void entryLabels(const Entry &entry,
+                     std::vector<std::string> &labels) const;
+
+    void writeSchema();
+    void writeFrame();
+    void writeRecord(RecordType type, uint32_t flags,
+                     const std::vector<uint8_t> &payload);
+
+  protected:
+    OutputStream *file;
+    const bool enableDelta;
+    const int compressionLevel;
+    const bool enableDescriptions;
+    const bool enableFormula;
+
+    /** Full path of every group visited during this dump. */
+    std::vector<std::string> groups;
+    std::vector<uint32_t> groupStack;
+
+    std::vector<Entry> entries;
+    std::vector<double> values;
+
+    /** Layout of the last schema record that was written. */
+    std::vector<std::string> schemaGroups;
+    std::vector<Entry> schemaEntries;
+    bool haveSchema;
+
+    /** Raw bits of the last frame, used for XOR encoding. */
+    std::vector<uint64_t> lastFrame;
+};
+
+std::unique_ptr<Output> initColumnar(
+    const std::string &filename, bool delta = true, int compression = 1,
+    bool desc = false, bool formulas = true);
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_COLUMNAR_HH__
@@ -69,7 +69,7 @@ nameMap()
 }
 
 Info::Info()
-    : flags(none), precision(-1), prereq(0), storageParams()
+    : flags(none), precision(-1), prereq(0), changed(true), storageParams()
 {
     id = id_count++;
     if (debug_break_id >= 0 and debug_break_id == id)
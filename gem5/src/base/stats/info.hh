@@ -99,6 +99,14 @@ class Info
      */
     static int id_count;
     int id;
+    /**
+     * Whether the stat was modified since its dirty flags were last
+     * cleared, as of the last call to prepare(). The flags are only
+     * cleared once a dump has completed, so this reflects the changes
+     * since the previous dump. Stats that don't track their
+     * modifications are always considered changed.
+     */
+    bool changed;
 
   private:
     std::unique_ptr<const StorageParams> storageParams;
@@ -145,6 +153,12 @@ class Info
      */
     virtual void prepare() = 0;
 
+    /**
+     * Start tracking modifications from the current state of the
+     * stat. Called once all outputs have dumped the stat.
+     */
+    virtual void clearDirty() {}
+
     /**
      * Reset the stat to the default state.
      */
@@ -41,6 +41,7 @@
 
 #include "base/stats/storage.hh"
 
+#include <algorithm>
 #include <cmath>
 
 namespace gem5
@@ -49,6 +50,9 @@ namespace gem5
 namespace statistics
 {
 
+size_type numShards = 1;
+__thread off_type curShard = 0;
+
 void
 DistStor::sample(Counter val, int number)
 {
@@ -70,6 +74,28 @@ DistStor::sample(Counter val, int number)
     sum += val * number;
     squares += val * val * number;
     samples += number;
+    dirty = true;
+}
+
+void
+DistStor::add(const DistStor *other)
+{
+    assert(size() == other->size());
+    assert(min_track == other->min_track);
+    assert(bucket_size == other->bucket_size);
+
+    min_val = std::min(min_val, other->min_val);
+    max_val = std::max(max_val, other->max_val);
+    underflow += other->underflow;
+    overflow += other->overflow;
+    sum += other->sum;
+    squares += other->squares;
+    samples += other->samples;
+
+    for (off_type i = 0; i < size(); ++i)
+        cvec[i] += other->cvec[i];
+
+    dirty = dirty || !other->zero();
 }
 
 void
@@ -203,6 +229,7 @@ HistStor::sample(Counter val, int number)
     squares += val * val * number;
     logs += std::log(val) * number;
     samples += number;
+    dirty = true;
 }
 
 void
@@ -224,6 +251,8 @@ HistStor::add(HistStor *hs)
 
     for (uint32_t i = 0; i < b_size; i++)
         cvec[i] += hs->cvec[i];
+
+    dirty = dirty || !hs->zero();
 }
 
 } // namespace statistics
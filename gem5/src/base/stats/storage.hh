@@ -32,6 +32,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <vector>
 
 #include "base/cast.hh"
 #include "base/compiler.hh"
@@ -50,6 +51,20 @@ struct StorageParams
     virtual ~StorageParams() = default;
 };
 
+/**
+ * Number of shards of the sharded storages. Storages use the value at
+ * the time they are created, so it must be set before the stats are
+ * initialized. It should be at least the number of threads that may
+ * update stats concurrently, i.e., the number of event queues.
+ */
+extern size_type numShards;
+
+/**
+ * Shard that sharded storages update from the current thread. Each
+ * simulation thread uses the index of the event queue it services.
+ */
+extern __thread off_type curShard;
+
 /**
  * Templatized storage and interface for a simple scalar stat.
  */
@@ -58,6 +73,8 @@ class StatStor
   private:
     /** The statistic value. */
     Counter data;
+    /** Whether the stat was modified since it was last dumped. */
+    bool dirty;
 
   public:
     struct Params : public StorageParams {};
@@ -67,26 +84,26 @@ class StatStor
      * datatype.
      */
     StatStor(const StorageParams* const storage_params)
-        : data(Counter())
+        : data(Counter()), dirty(false)
     { }
 
     /**
      * The the stat to the given value.
      * @param val The new value.
      */
-    void set(Counter val) { data = val; }
+    void set(Counter val) { data = val; dirty = true; }
 
     /**
      * Increment the stat by the given value.
      * @param val The new value.
      */
-    void inc(Counter val) { data += val; }
+    void inc(Counter val) { data += val; dirty = true; }
 
     /**
      * Decrement the stat by the given value.
      * @param val The new value.
      */
-    void dec(Counter val) { data -= val; }
+    void dec(Counter val) { data -= val; dirty = true; }
 
     /**
      * Return the value of this stat as its base type.
@@ -108,12 +125,28 @@ class StatStor
     /**
      * Reset stat value to default
      */
-    void reset(const StorageParams* const storage_params) { data = Counter(); }
+    void
+    reset(const StorageParams* const storage_params)
+    {
+        dirty = dirty || !zero();
+        data = Counter();
+    }
 
     /**
      * @return true if zero value
      */
     bool zero() const { return data == Counter(); }
+
+    /**
+     * @return true if the stat was modified since the last call to
+     * clearDirty()
+     */
+    bool isDirty() const { return dirty; }
+
+    /**
+     * Start tracking modifications from the current state of the stat.
+     */
+    void clearDirty() { dirty = false; }
 };
 
 /**
@@ -134,6 +167,8 @@ class AvgStor
     mutable Result total;
     /** The tick that current last changed. */
     mutable Tick last;
+    /** Whether the stat was modified since it was last dumped. */
+    bool dirty;
 
   public:
     struct Params : public StorageParams {};
@@ -142,7 +177,7 @@ class AvgStor
      * Build and initializes this stat storage.
      */
     AvgStor(const StorageParams* const storage_params)
-        : current(0), lastReset(0), total(0), last(0)
+        : current(0), lastReset(0), total(0), last(0), dirty(false)
     { }
 
     /**
@@ -156,6 +191,7 @@ class AvgStor
         total += current * (curTick() - last);
         last = curTick();
         current = val;
+        dirty = true;
     }
 
     /**
@@ -192,6 +228,18 @@ class AvgStor
      */
     bool zero() const { return total == 0.0; }
 
+    /**
+     * @return true if the stat was modified since the last call to
+     * clearDirty(). The average changes over time as long as the current
+     * count isn't zero.
+     */
+    bool isDirty() const { return dirty || current != Counter(); }
+
+    /**
+     * Start tracking modifications from the current state of the stat.
+     */
+    void clearDirty() { dirty = false; }
+
     /**
      * Prepare stat data for dumping or serialization
      */
@@ -208,6 +256,7 @@ class AvgStor
     void
     reset(const StorageParams* const storage_params)
     {
+        dirty = dirty || !zero();
         total = 0.0;
         last = curTick();
         lastReset = curTick();
@@ -255,6 +304,8 @@ class DistStor
     Counter samples;
     /** Counter for each bucket. */
     VCounter cvec;
+    /** Whether the stat was modified since it was last dumped. */
+    bool dirty;
 
   public:
     /** The parameters for a distribution stat. */
@@ -288,6 +339,7 @@ class DistStor
         : cvec(safe_cast<const Params *>(storage_params)->buckets)
     {
         reset(storage_params);
+        dirty = false;
     }
 
     /**
@@ -297,6 +349,12 @@ class DistStor
      */
     void sample(Counter val, int number);
 
+    /**
+     * Adds the contents of the given storage to this storage.
+     * @param other The other storage to be added.
+     */
+    void add(const DistStor *other);
+
     /**
      * Return the number of buckets in this distribution.
      * @return the number of buckets.
@@ -313,6 +371,17 @@ class DistStor
         return samples == Counter();
     }
 
+    /**
+     * @return true if the stat was modified since the last call to
+     * clearDirty()
+     */
+    bool isDirty() const { return dirty; }
+
+    /**
+     * Start tracking modifications from the current state of the stat.
+     */
+    void clearDirty() { dirty = false; }
+
     void
     prepare(const StorageParams* const storage_params, DistData &data)
     {
@@ -345,6 +414,7 @@ class DistStor
     reset(const StorageParams* const storage_params)
     {
         const Params *params = safe_cast<const Params *>(storage_params);
+        dirty = dirty || !zero();
         min_track = params->min;
         max_track = params->max;
         bucket_size = params->bucket_size;
@@ -415,6 +485,8 @@ class HistStor
     Counter samples;
     /** Counter for each bucket. */
     VCounter cvec;
+    /** Whether the stat was modified since it was last dumped. */
+    bool dirty;
 
     /**
      * Given a bucket size B, and a range of values [0, N], this function
@@ -474,6 +546,7 @@ class HistStor
         : cvec(safe_cast<const Params *>(storage_params)->buckets)
     {
         reset(storage_params);
+        dirty = false;
     }
 
     /**
@@ -505,6 +578,17 @@ class HistStor
         return samples == Counter();
     }
 
+    /**
+     * @return true if the stat was modified since the last call to
+     * clearDirty()
+     */
+    bool isDirty() const { return dirty; }
+
+    /**
+     * Start tracking modifications from the current state of the stat.
+     */
+    void clearDirty() { dirty = false; }
+
     void
     prepare(const StorageParams* const storage_params, DistData &data)
     {
@@ -537,6 +621,7 @@ class HistStor
     reset(const StorageParams* const storage_params)
     {
         const Params *params = safe_cast<const Params *>(storage_params);
+        dirty = dirty || !zero();
         min_bucket = 0;
         max_bucket = params->buckets - 1;
         bucket_size = 1;
@@ -565,6 +650,8 @@ class SampleStor
     Counter squares;
     /** The number of samples. */
     Counter samples;
+    /** Whether the stat was modified since it was last dumped. */
+    bool dirty;
 
   public:
     struct Params : public DistParams
@@ -576,7 +663,8 @@ class SampleStor
      * Create and initialize this storage.
      */
     SampleStor(const StorageParams* const storage_params)
-        : sum(Counter()), squares(Counter()), samples(Counter())
+        : sum(Counter()), squares(Counter()), samples(Counter()),
+          dirty(false)
     { }
 
     /**
@@ -592,6 +680,7 @@ class SampleStor
         sum += val * number;
         squares += val * val * number;
         samples += number;
+        dirty = true;
     }
 
     /**
@@ -606,6 +695,17 @@ class SampleStor
      */
     bool zero() const { return samples == Counter(); }
 
+    /**
+     * @return true if the stat was modified since the last call to
+     * clearDirty()
+     */
+    bool isDirty() const { return dirty; }
+
+    /**
+     * Start tracking modifications from the current state of the stat.
+     */
+    void clearDirty() { dirty = false; }
+
     void
     prepare(const StorageParams* const storage_params, DistData &data)
     {
@@ -624,6 +724,7 @@ class SampleStor
     void
     reset(const StorageParams* const storage_params)
     {
+        dirty = dirty || !zero();
         sum = Counter();
         squares = Counter();
         samples = Counter();
@@ -641,6 +742,8 @@ class AvgSampleStor
     Counter sum;
     /** Current sum of squares. */
     Counter squares;
+    /** Whether the stat was modified since it was last dumped. */
+    bool dirty;
 
   public:
     struct Params : public DistParams
@@ -652,7 +755,7 @@ class AvgSampleStor
      * Create and initialize this storage.
      */
     AvgSampleStor(const StorageParams* const storage_params)
-        : sum(Counter()), squares(Counter())
+        : sum(Counter()), squares(Counter()), dirty(false)
     {}
 
     /**
@@ -666,6 +769,7 @@ class AvgSampleStor
     {
         sum += val * number;
         squares += val * val * number;
+        dirty = true;
     }
 
     /**
@@ -680,6 +784,18 @@ class AvgSampleStor
      */
     bool zero() const { return sum == Counter(); }
 
+    /**
+     * @return true if the stat was modified since the last call to
+     * clearDirty(). The per tick mean changes over time as long as the
+     * sum isn't zero.
+     */
+    bool isDirty() const { return dirty || !zero(); }
+
+    /**
+     * Start tracking modifications from the current state of the stat.
+     */
+    void clearDirty() { dirty = false; }
+
     void
     prepare(const StorageParams* const storage_params, DistData &data)
     {
@@ -698,6 +814,7 @@ class AvgSampleStor
     void
     reset(const StorageParams* const storage_params)
     {
+        dirty = dirty || !zero();
         sum = Counter();
         squares = Counter();
     }
@@ -717,6 +834,8 @@ class SparseHistStor
     Counter samples;
     /** Counter for each bucket. */
     MCounter cmap;
+    /** Whether the stat was modified since it was last dumped. */
+    bool dirty;
 
   public:
     /** The parameters for a sparse histogram stat. */
@@ -728,6 +847,7 @@ class SparseHistStor
     SparseHistStor(const StorageParams* const storage_params)
     {
         reset(storage_params);
+        dirty = false;
     }
 
     /**
@@ -740,6 +860,7 @@ class SparseHistStor
     {
         cmap[val] += number;
         samples += number;
+        dirty = true;
     }
 
     /**
@@ -758,6 +879,17 @@ class SparseHistStor
         return samples == Counter();
     }
 
+    /**
+     * @return true if the stat was modified since the last call to
+     * clearDirty()
+     */
+    bool isDirty() const { return dirty; }
+
+    /**
+     * Start tracking modifications from the current state of the stat.
+     */
+    void clearDirty() { dirty = false; }
+
     void
     prepare(const StorageParams* const storage_params, SparseHistData &data)
     {
@@ -776,11 +908,255 @@ class SparseHistStor
     void
     reset(const StorageParams* const storage_params)
     {
+        dirty = dirty || !zero();
         cmap.clear();
         samples = 0;
     }
 };
 
+/**
+ * Storage for a simple scalar stat that is updated concurrently by
+ * several threads. Each thread updates its own counter, held in its own
+ * cache line, and the counters are merged when the stat is read.
+ * @sa numShards
+ */
+class ShardedStatStor
+{
+  private:
+    struct alignas(64) Shard
+    {
+        /** The part of the statistic value counted by this shard. */
+        Counter data = Counter();
+        /** Whether the shard was modified since it was last dumped. */
+        bool dirty = false;
+    };
+
+    std::vector<Shard> shards;
+
+    Shard &
+    shard()
+    {
+        assert(curShard < shards.size());
+        return shards[curShard];
+    }
+
+  public:
+    struct Params : public StorageParams {};
+
+    ShardedStatStor(const StorageParams* const storage_params)
+        : shards(numShards)
+    { }
+
+    /**
+     * Set the stat to the given value. Updates made concurrently by
+     * other threads may be lost.
+     * @param val The new value.
+     */
+    void
+    set(Counter val)
+    {
+        Shard &s = shard();
+        s.data += val - value();
+        s.dirty = true;
+    }
+
+    /**
+     * Increment the stat by the given value.
+     * @param val The new value.
+     */
+    void
+    inc(Counter val)
+    {
+        Shard &s = shard();
+        s.data += val;
+        s.dirty = true;
+    }
+
+    /**
+     * Decrement the stat by the given value.
+     * @param val The new value.
+     */
+    void
+    dec(Counter val)
+    {
+        Shard &s = shard();
+        s.data -= val;
+        s.dirty = true;
+    }
+
+    /**
+     * Return the value of this stat as its base type.
+     * @return The value of this stat.
+     */
+    Counter
+    value() const
+    {
+        Counter total = Counter();
+        for (const auto &s : shards)
+            total += s.data;
+        return total;
+    }
+
+    /**
+     * Return the value of this stat as a result type.
+     * @return The value of this stat.
+     */
+    Result result() const { return (Result)value(); }
+
+    /**
+     * Prepare stat data for dumping or serialization
+     */
+    void prepare(const StorageParams* const storage_params) { }
+
+    /**
+     * Reset stat value to default
+     */
+    void
+    reset(const StorageParams* const storage_params)
+    {
+        const bool was_zero = zero();
+        for (auto &s : shards) {
+            s.dirty = s.dirty || !was_zero;
+            s.data = Counter();
+        }
+    }
+
+    /**
+     * @return true if zero value
+     */
+    bool zero() const { return value() == Counter(); }
+
+    /**
+     * @return true if the stat was modified since the last call to
+     * clearDirty()
+     */
+    bool
+    isDirty() const
+    {
+        for (const auto &s : shards) {
+            if (s.dirty)
+                return true;
+        }
+        return false;
+    }
+
+    /**
+     * Start tracking modifications from the current state of the stat.
+     */
+    void
+    clearDirty()
+    {
+        for (auto &s : shards)
+            s.dirty = false;
+    }
+};
+
+/**
+ * Storage for a distribution stat that is sampled concurrently by
+ * several threads. Each thread samples its own distribution, and the
+ * distributions are merged when the stat is prepared for dumping.
+ * @sa numShards
+ */
+class ShardedDistStor
+{
+  private:
+    struct alignas(64) Shard
+    {
+        DistStor stor;
+
+        Shard(const StorageParams* const storage_params)
+            : stor(storage_params)
+        { }
+    };
+
+    std::vector<Shard> shards;
+
+  public:
+    typedef DistStor::Params Params;
+
+    ShardedDistStor(const StorageParams* const storage_params)
+    {
+        shards.reserve(numShards);
+        for (size_type i = 0; i < numShards; ++i)
+            shards.emplace_back(storage_params);
+    }
+
+    /**
+     * Add a value to the distribution for the given number of times.
+     * @param val The value to add.
+     * @param number The number of times to add the value.
+     */
+    void
+    sample(Counter val, int number)
+    {
+        assert(curShard < shards.size());
+        shards[curShard].stor.sample(val, number);
+    }
+
+    /**
+     * Return the number of buckets in this distribution.
+     * @return the number of buckets.
+     */
+    size_type size() const { return shards[0].stor.size(); }
+
+    /**
+     * Returns true if any calls to sample have been made.
+     * @return True if any values have been sampled.
+     */
+    bool
+    zero() const
+    {
+        for (const auto &s : shards) {
+            if (!s.stor.zero())
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @return true if the stat was modified since the last call to
+     * clearDirty()
+     */
+    bool
+    isDirty() const
+    {
+        for (const auto &s : shards) {
+            if (s.stor.isDirty())
+                return true;
+        }
+        return false;
+    }
+
+    /**
+     * Start tracking modifications from the current state of the stat.
+     */
+    void
+    clearDirty()
+    {
+        for (auto &s : shards)
+            s.stor.clearDirty();
+    }
+
+    void
+    prepare(const StorageParams* const storage_params, DistData &data)
+    {
+        DistStor merged(shards[0].stor);
+        for (size_type i = 1; i < shards.size(); ++i)
+            merged.add(&shards[i].stor);
+        merged.prepare(storage_params, data);
+    }
+
+    /**
+     * Reset stat value to default
+     */
+    void
+    reset(const StorageParams* const storage_params)
+    {
+        for (auto &s : shards)
+            s.stor.reset(storage_params);
+    }
+};
+
 } // namespace statistics
 } // namespace gem5
 
@@ -129,6 +129,37 @@ TEST(StatsStatStorTest, ZeroReset)
     ASSERT_FALSE(stor.zero());
 }
 
+/**
+ * Test that modifications mark the storage as dirty until the dirty flag
+ * is cleared, and that a reset only marks it dirty if the value changed.
+ */
+TEST(StatsStatStorTest, Dirty)
+{
+    statistics::StatStor stor(nullptr);
+
+    ASSERT_FALSE(stor.isDirty());
+
+    stor.inc(10);
+    ASSERT_TRUE(stor.isDirty());
+    stor.clearDirty();
+    ASSERT_FALSE(stor.isDirty());
+
+    stor.dec(10);
+    ASSERT_TRUE(stor.isDirty());
+    stor.clearDirty();
+
+    stor.set(10);
+    ASSERT_TRUE(stor.isDirty());
+    stor.clearDirty();
+
+    stor.reset(nullptr);
+    ASSERT_TRUE(stor.isDirty());
+    stor.clearDirty();
+
+    stor.reset(nullptr);
+    ASSERT_FALSE(stor.isDirty());
+}
+
 /** Test setting and getting a value to the storage. */
 TEST(StatsAvgStorTest, SetValueResult)
 {
@@ -249,6 +280,26 @@ TEST(StatsAvgStorTest, ZeroReset)
     ASSERT_FALSE(stor.zero());
 }
 
+/**
+ * Test that the storage is dirty while its current count is not zero,
+ * since its average changes over time.
+ */
+TEST(StatsAvgStorTest, Dirty)
+{
+    statistics::AvgStor stor(nullptr);
+
+    ASSERT_FALSE(stor.isDirty());
+
+    stor.set(10);
+    stor.clearDirty();
+    ASSERT_TRUE(stor.isDirty());
+
+    stor.set(0);
+    ASSERT_TRUE(stor.isDirty());
+    stor.clearDirty();
+    ASSERT_FALSE(stor.isDirty());
+}
+
 #if TRACING_ON
 /** Test that an assertion is thrown when bucket size is 0. */
 TEST(StatsDistStorDeathTest, BucketSize0)
@@ -279,6 +330,30 @@ TEST(StatsDistStorTest, ZeroReset)
     ASSERT_TRUE(stor.zero());
 }
 
+/**
+ * Test that sampling marks the storage as dirty until the dirty flag is
+ * cleared, and that a reset only marks it dirty if it had samples.
+ */
+TEST(StatsDistStorTest, Dirty)
+{
+    statistics::DistStor::Params params(0, 99, 10);
+    statistics::DistStor stor(&params);
+
+    ASSERT_FALSE(stor.isDirty());
+
+    stor.sample(10, 5);
+    ASSERT_TRUE(stor.isDirty());
+    stor.clearDirty();
+    ASSERT_FALSE(stor.isDirty());
+
+    stor.reset(&params);
+    ASSERT_TRUE(stor.isDirty());
+    stor.clearDirty();
+
+    stor.reset(&params);
+    ASSERT_FALSE(stor.isDirty());
+}
+
 /**
  * Test that the size of this storage is equal to its counters vector's size,
  * and that after it has been set, nothing can modify it.
@@ -507,6 +582,30 @@ TEST(StatsHistStorTest, ZeroReset)
     ASSERT_TRUE(stor.zero());
 }
 
+/**
+ * Test that sampling marks the storage as dirty until the dirty flag is
+ * cleared, and that a reset only marks it dirty if it had samples.
+ */
+TEST(StatsHistStorTest, Dirty)
+{
+    statistics::HistStor::Params params(10);
+    statistics::HistStor stor(&params);
+
+    ASSERT_FALSE(stor.isDirty());
+
+    stor.sample(10, 5);
+    ASSERT_TRUE(stor.isDirty());
+    stor.clearDirty();
+    ASSERT_FALSE(stor.isDirty());
+
+    stor.reset(&params);
+    ASSERT_TRUE(stor.isDirty());
+    stor.clearDirty();
+
+    stor.reset(&params);
+    ASSERT_FALSE(stor.isDirty());
+}
+
 /**
  * Test that the size of this storage is equal to its counters vector's size,
  * and that after it has been set, nothing can modify it.
@@ -970,6 +1069,21 @@ TEST(StatsHistStorTest, Add)
     checkExpectedDistData(merge_data, expected_data, false);
 }
 
+/** Test that adding a storage with samples marks the storage as dirty. */
+TEST(StatsHistStorTest, AddDirty)
+{
+    statistics::HistStor::Params params(10);
+    statistics::HistStor stor(&params);
+    statistics::HistStor other(&params);
+
+    stor.add(&other);
+    ASSERT_FALSE(stor.isDirty());
+
+    other.sample(10, 5);
+    stor.add(&other);
+    ASSERT_TRUE(stor.isDirty());
+}
+
 /**
  * Test whether zero is correctly set as the reset value. The test order is
  * to check if it is initially zero on creation, then it is made non zero,
@@ -991,6 +1105,29 @@ TEST(StatsSampleStorTest, ZeroReset)
     ASSERT_TRUE(stor.zero());
 }
 
+/**
+ * Test that sampling marks the storage as dirty until the dirty flag is
+ * cleared, and that a reset only marks it dirty if it had samples.
+ */
+TEST(StatsSampleStorTest, Dirty)
+{
+    statistics::SampleStor stor(nullptr);
+
+    ASSERT_FALSE(stor.isDirty());
+
+    stor.sample(10, 5);
+    ASSERT_TRUE(stor.isDirty());
+    stor.clearDirty();
+    ASSERT_FALSE(stor.isDirty());
+
+    stor.reset(nullptr);
+    ASSERT_TRUE(stor.isDirty());
+    stor.clearDirty();
+
+    stor.reset(nullptr);
+    ASSERT_FALSE(stor.isDirty());
+}
+
 /** Test setting and getting value from storage. */
 TEST(StatsSampleStorTest, SamplePrepare)
 {
@@ -1083,6 +1220,26 @@ TEST(StatsAvgSampleStorTest, ZeroReset)
     ASSERT_TRUE(stor.zero());
 }
 
+/**
+ * Test that the storage is dirty while its sum is not zero, since its
+ * per tick mean changes over time.
+ */
+TEST(StatsAvgSampleStorTest, Dirty)
+{
+    statistics::AvgSampleStor stor(nullptr);
+
+    ASSERT_FALSE(stor.isDirty());
+
+    stor.sample(10, 5);
+    stor.clearDirty();
+    ASSERT_TRUE(stor.isDirty());
+
+    stor.reset(nullptr);
+    ASSERT_TRUE(stor.isDirty());
+    stor.clearDirty();
+    ASSERT_FALSE(stor.isDirty());
+}
+
 /** Test setting and getting value from storage. */
 TEST(StatsAvgSampleStorTest, SamplePrepare)
 {
@@ -1176,6 +1333,29 @@ TEST(StatsSparseHistStorTest, ZeroReset)
     ASSERT_TRUE(stor.zero());
 }
 
+/**
+ * Test that sampling marks the storage as dirty until the dirty flag is
+ * cleared, and that a reset only marks it dirty if it had samples.
+ */
+TEST(StatsSparseHistStorTest, Dirty)
+{
+    statistics::SparseHistStor stor(nullptr);
+
+    ASSERT_FALSE(stor.isDirty());
+
+    stor.sample(10, 5);
+    ASSERT_TRUE(stor.isDirty());
+    stor.clearDirty();
+    ASSERT_FALSE(stor.isDirty());
+
+    stor.reset(nullptr);
+    ASSERT_TRUE(stor.isDirty());
+    stor.clearDirty();
+
+    stor.reset(nullptr);
+    ASSERT_FALSE(stor.isDirty());
+}
+
 /** Test setting and getting value from storage. */
 TEST(StatsSparseHistStorTest, SamplePrepare)
 {
@@ -1214,3 +1394,93 @@ TEST(StatsSparseHistStorTest, SamplePrepare)
     }
     ASSERT_EQ(data.samples, total_samples);
 }
+
+/** Test that the values counted in all shards are merged. */
+TEST(StatsShardedStatStorTest, IncDecSet)
+{
+    statistics::numShards = 4;
+    statistics::ShardedStatStor stor(nullptr);
+    statistics::numShards = 1;
+
+    for (statistics::off_type i = 0; i < 4; i++) {
+        statistics::curShard = i;
+        stor.inc(10 * (i + 1));
+    }
+    statistics::curShard = 1;
+    stor.dec(5);
+    ASSERT_EQ(stor.value(), 95);
+    ASSERT_EQ(stor.result(), statistics::Result(95));
+
+    statistics::curShard = 2;
+    stor.set(7);
+    ASSERT_EQ(stor.value(), 7);
+
+    statistics::curShard = 0;
+}
+
+/**
+ * Test that the storage is only zero if all shards are zero, and that
+ * resetting it clears all shards.
+ */
+TEST(StatsShardedStatStorTest, ZeroResetDirty)
+{
+    statistics::numShards = 2;
+    statistics::ShardedStatStor stor(nullptr);
+    statistics::numShards = 1;
+
+    ASSERT_TRUE(stor.zero());
+    ASSERT_FALSE(stor.isDirty());
+
+    statistics::curShard = 1;
+    stor.inc(10);
+    statistics::curShard = 0;
+    ASSERT_FALSE(stor.zero());
+    ASSERT_TRUE(stor.isDirty());
+
+    stor.clearDirty();
+    ASSERT_FALSE(stor.isDirty());
+
+    stor.reset(nullptr);
+    ASSERT_TRUE(stor.zero());
+    ASSERT_TRUE(stor.isDirty());
+}
+
+/**
+ * Test that sampling a sharded distribution from several shards yields
+ * the same data as sampling a single distribution.
+ */
+TEST(StatsShardedDistStorTest, SamplePrepare)
+{
+    statistics::DistStor::Params params(0, 19, 2);
+    statistics::numShards = 3;
+    statistics::ShardedDistStor stor(&params);
+    statistics::numShards = 1;
+    statistics::DistStor ref(&params);
+    ValueSamples values[] = {{-10, 1}, {0, 2}, {5, 3}, {13, 4}, {25, 5}};
+    statistics::DistData data;
+    statistics::DistData ref_data;
+
+    ASSERT_TRUE(stor.zero());
+    for (int i = 0; i < 5; i++) {
+        statistics::curShard = i % 3;
+        stor.sample(values[i].value, values[i].numSamples);
+        ref.sample(values[i].value, values[i].numSamples);
+    }
+    statistics::curShard = 0;
+    ASSERT_FALSE(stor.zero());
+    ASSERT_EQ(stor.size(), ref.size());
+
+    stor.prepare(&params, data);
+    ref.prepare(&params, ref_data);
+    ASSERT_EQ(data.min_val, ref_data.min_val);
+    ASSERT_EQ(data.max_val, ref_data.max_val);
+    ASSERT_EQ(data.underflow, ref_data.underflow);
+    ASSERT_EQ(data.overflow, ref_data.overflow);
+    ASSERT_EQ(data.sum, ref_data.sum);
+    ASSERT_EQ(data.squares, ref_data.squares);
+    ASSERT_EQ(data.samples, ref_data.samples);
+    ASSERT_EQ(data.cvec, ref_data.cvec);
+
+    stor.reset(&params);
+    ASSERT_TRUE(stor.zero());
+}
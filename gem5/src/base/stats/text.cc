@@ -73,7 +73,8 @@ namespace statistics
 std::list<Info *> &statsList();
 
 Text::Text()
-    : mystream(false), stream(NULL), descriptions(false), spaces(false)
+    : mystream(false), stream(NULL), dumped(false), descriptions(false),
+      spaces(false), incremental(false)
 {
 }
 
@@ -137,6 +138,7 @@ Text::end()
 {
     ccprintf(*stream, "\n---------- End Simulation Statistics   ----------\n");
     stream->flush();
+    dumped = true;
 }
 
 std::string
@@ -174,6 +176,9 @@ Text::noOutput(const Info &info)
     if (info.prereq && info.prereq->zero())
         return true;
 
+    if (incremental && dumped && !info.changed)
+        return true;
+
     return false;
 }
 
@@ -801,7 +806,8 @@ Text::visit(const SparseHistInfo &info)
 }
 
 Output *
-initText(const std::string &filename, bool desc, bool spaces)
+initText(const std::string &filename, bool desc, bool spaces,
+         bool incremental)
 {
     static Text text;
     static bool connected = false;
@@ -811,6 +817,7 @@ initText(const std::string &filename, bool desc, bool spaces)
         text.descriptions = desc;
         text.enableUnits = desc; // the units are printed if descs are
         text.spaces = spaces;
+        text.incremental = incremental;
         connected = true;
     }
 
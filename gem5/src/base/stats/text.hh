@@ -65,6 +65,9 @@ class Text : public Output
     // Object/group path
     std::stack<std::string> path;
 
+    /** Has a complete dump been written to the stream yet? */
+    bool dumped;
+
   protected:
     bool noOutput(const Info &info);
 
@@ -72,6 +75,11 @@ class Text : public Output
     bool enableUnits;
     bool descriptions;
     bool spaces;
+    /**
+     * Only output stats that changed since the previous dump. The first
+     * dump is always complete.
+     */
+    bool incremental;
 
   public:
     Text();
@@ -104,7 +112,8 @@ class Text : public Output
 
 std::string ValueToString(Result value, int precision);
 
-Output *initText(const std::string &filename, bool desc, bool spaces);
+Output *initText(const std::string &filename, bool desc, bool spaces,
+                 bool incremental = false);
 
 } // namespace statistics
 } // namespace gem5
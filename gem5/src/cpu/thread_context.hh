@@ -51,6 +51,7 @@
 #include "base/types.hh"
 #include "cpu/pc_event.hh"
 #include "cpu/reg_class.hh"
+#include "mem/backdoor.hh"
 
 namespace gem5
 {
@@ -144,6 +145,13 @@ class ThreadContext : public PCEventScope
 
     virtual void sendFunctional(PacketPtr pkt);
 
+    /**
+     * Ask the memory system behind this thread's data port for a backdoor.
+     * The backdoor pointer is left untouched if none is available.
+     */
+    virtual void sendMemBackdoorReq(const MemBackdoorReq &req,
+                                    MemBackdoorPtr &backdoor);
+
     virtual Process *getProcessPtr() = 0;
 
     virtual void setProcessPtr(Process *p) = 0;
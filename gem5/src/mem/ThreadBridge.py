@@ -24,6 +24,7 @@
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 from m5.params import *
+from m5.proxy import *
 from m5.SimObject import SimObject
 
 
@@ -39,14 +40,19 @@ class ThreadBridge(SimObject):
     the issue. The receiver side is expected to use the same EventQueue that
     the ThreadBridge is using.
 
-    Given that this is only used for simulation speed accelerating, only the
-    atomic and functional access are supported.
+    Atomic and functional accesses are migrated and performed immediately.
+    Timing packets are handed over to the other side after a fixed delay,
+    which must be at least the simulation quantum so that a packet never
+    arrives in the past of the receiving queue. At most req_size timing
+    requests can be outstanding across the bridge, further requests are
+    refused until one completes. Timing snoops are only forwarded as
+    notifications, the snooper behind the bridge cannot respond to them.
 
     Example:
 
     sys.initator = Initiator(eventq_index=0)
     sys.target = Target(eventq_index=1)
-    sys.bridge = ThreadBridge(eventq_index=1)
+    sys.bridge = ThreadBridge(eventq_index=1, in_eventq_index=0)
 
     sys.initator.out_port = sys.bridge.in_port
     sys.bridge.out_port = sys.target.in_port
@@ -58,3 +64,13 @@ class ThreadBridge(SimObject):
 
     in_port = ResponsePort("Incoming port")
     out_port = RequestPort("Outgoing port")
+
+    in_eventq_index = Param.UInt32(
+        Parent.eventq_index, "Event queue the initiator side runs on"
+    )
+    delay = Param.Latency("0ns", "Delay of timing packets over the bridge")
+    req_size = Param.Unsigned(
+        16,
+        "The number of timing requests that can be outstanding across the "
+        "bridge, including the ones waiting for their response",
+    )
@@ -43,7 +43,8 @@ from m5.objects.ReplacementPolicies import *
 from m5.objects.Tags import *
 from m5.params import *
 from m5.proxy import *
-from m5.SimObject import SimObject
+from m5.proxy import isproxy
+from m5.SimObject import PyBindMethod, SimObject
 
 
 # Enum for cache clusivity, currently mostly inclusive or mostly
@@ -83,6 +84,12 @@ class BaseCache(ClockedObject):
     cxx_header = "mem/cache/base.hh"
     cxx_class = "gem5::BaseCache"
 
+    cxx_exports = [
+        PyBindMethod("startWarming"),
+        PyBindMethod("stopWarming"),
+        PyBindMethod("dirtyBlocks"),
+    ]
+
     size = Param.MemorySize("Capacity")
     assoc = Param.Unsigned("Associativity")
 
@@ -108,6 +115,17 @@ class BaseCache(ClockedObject):
     prefetcher = Param.BasePrefetcher(NULL, "Prefetcher attached to cache")
 
     tags = Param.BaseTags(BaseSetAssoc(), "Tag store")
+
+    # Alternative tag stores (e.g., BaseSetAssoc(size="1MiB", assoc=16,
+    # replacement_policy=RRIPRP())) that observe the same accesses as this
+    # cache but hold no data and do not affect its behaviour. They are used
+    # to estimate the miss rate of many cache configurations in a single
+    # run. To keep them apart from the cache, adoptOrphanParams() removes
+    # their partitioning manager and gives each one its own replacement
+    # policy.
+    shadow_tags = VectorParam.BaseTags(
+        [], "Tag stores shadowing this cache's accesses"
+    )
     replacement_policy = Param.BaseReplacementPolicy(
         LRURP(), "Replacement policy"
     )
@@ -169,6 +187,27 @@ class BaseCache(ClockedObject):
     # data cache.
     write_allocator = Param.WriteAllocator(NULL, "Write allocator")
 
+    def adoptOrphanParams(self):
+        # Shadow tags would otherwise take the partitioning manager and the
+        # replacement policy of the cache from their parent, and update the
+        # partition occupancy and policy-wide state (e.g., SHiP's SHCT) of
+        # the cache with their own traffic. A policy shared with the cache
+        # or another shadow is replaced by a copy.
+        policies = [self.replacement_policy]
+        for shadow in self.shadow_tags:
+            shadow.partitioning_manager = NULL
+            if "replacement_policy" not in shadow._params:
+                continue
+            policy = shadow.replacement_policy
+            if isproxy(policy):
+                policy = self.replacement_policy
+            if any(policy is other for other in policies):
+                policy = policy()
+                shadow.replacement_policy = policy
+            policies.append(policy)
+
+        super().adoptOrphanParams()
+
 
 class Cache(BaseCache):
     type = "Cache"
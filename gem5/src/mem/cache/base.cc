@@ -47,6 +47,7 @@
 
 #include "base/compiler.hh"
 #include "base/logging.hh"
+#include "base/random.hh"
 #include "debug/Cache.hh"
 #include "debug/CacheComp.hh"
 #include "debug/CachePort.hh"
@@ -86,6 +87,7 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       mshrQueue("MSHRs", p.mshrs, 0, p.demand_mshr_reserve, p.name),
       writeBuffer("write buffer", p.write_buffers, p.mshrs, p.name),
       tags(p.tags),
+      shadowTags(p.shadow_tags),
       compressor(p.compressor),
       partitionManager(p.partitioning_manager),
       prefetcher(p.prefetcher),
@@ -128,6 +130,12 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
     tempBlock = new TempCacheBlk(blkSize);
 
     tags->tagsInit();
+    for (auto shadow : shadowTags) {
+        fatal_if(dynamic_cast<CompressedTags*>(shadow),
+            "The shadow tags of cache %s cannot be compressed", name());
+        shadow->tagsInit();
+        shadowStats.emplace_back(new ShadowTagStats(*shadow));
+    }
     if (prefetcher)
         prefetcher->setParentInfo(system, getProbeManager(), getBlockSize());
 
@@ -1256,6 +1264,9 @@ BaseCache::access(PacketPtr pkt, CacheBlk *&blk, Cycles &lat,
     DPRINTF(Cache, "%s for %s %s\n", __func__, pkt->print(),
             blk ? "hit " + blk->print() : "miss");
 
+    if (!shadowTags.empty())
+        accessShadowTags(pkt);
+
     if (pkt->req->isCacheMaintenance()) {
         // A cache maintenance operation is always forwarded to the
         // memory below even if the block is found in dirty state.
@@ -1675,6 +1686,208 @@ BaseCache::allocateBlock(const PacketPtr pkt, PacketList &writebacks)
     return victim;
 }
 
+void
+BaseCache::accessShadowTags(const PacketPtr pkt)
+{
+    // Only requests that would look up and possibly fill a block are
+    // replayed; evictions that do not carry data and maintenance
+    // operations leave the shadow tags untouched
+    if (pkt->req->isCacheMaintenance() ||
+        (!pkt->isRead() && !pkt->isWrite())) {
+        return;
+    }
+
+    const bool allocate = pkt->isWriteback() ||
+        pkt->cmd == MemCmd::WriteClean || allocOnFill(pkt->cmd);
+    const auto partition_id = partitionManager ?
+        partitionManager->readPacketPartitionID(pkt) : 0;
+
+    // Replacement policies such as Random and BRRIP draw from the global
+    // random number generator, so restore it afterwards for the draws of
+    // the rest of the system not to depend on the shadow tags
+    const auto rng_state = random_mt.gen;
+
+    for (size_t i = 0; i < shadowTags.size(); i++) {
+        BaseTags *shadow = shadowTags[i];
+        Cycles lat(0);
+        if (shadow->accessBlock(pkt, lat)) {
+            shadowStats[i]->hits++;
+            continue;
+        }
+        shadowStats[i]->misses++;
+
+        if (!allocate)
+            continue;
+
+        std::vector<CacheBlk*> evict_blks;
+        CacheBlk *victim = shadow->findVictim(pkt->getAddr(),
+            pkt->isSecure(), blkSize * 8, evict_blks, partition_id);
+        if (!victim)
+            continue;
+
+        // There is no data to write back, so evicting is just dropping
+        // the blocks
+        for (auto &blk : evict_blks) {
+            if (blk->isValid())
+                shadow->invalidate(blk);
+        }
+        shadow->insertBlock(pkt, victim);
+        victim->setCoherenceBits(CacheBlk::ReadableBit);
+    }
+
+    random_mt.gen = rng_state;
+}
+
+bool
+BaseCache::recordWarmingAccess(const PacketPtr pkt)
+{
+    if (pkt->req->isUncacheable() || pkt->req->isCacheMaintenance() ||
+        (!pkt->isRead() && !pkt->isWrite())) {
+        return false;
+    }
+
+    const bool hit = warmingTags->access(pkt->getAddr(), pkt->isSecure(),
+        pkt->req->requestorId(),
+        pkt->isWriteback() || allocOnFill(pkt->cmd), pkt->isWrite());
+
+    // A cache above asking for a writable copy takes the ownership over,
+    // so only that cache ends up holding the block dirty
+    if (hit && pkt->fromCache() && pkt->needsWritable())
+        warmingTags->clean(pkt->getAddr(), pkt->isSecure());
+
+    return hit;
+}
+
+Tick
+BaseCache::recvWarmingAtomic(PacketPtr pkt)
+{
+    // Accesses that hit in the warming tags would not have left a real
+    // cache, so they must not be recorded by the caches below either.
+    // Plain reads and writes, and the writable fetches of the caches
+    // above, are serviced functionally, which the caches below don't
+    // record, and which is exact as no cache holds any block while
+    // warming up.
+    const bool plain = (pkt->cmd == MemCmd::ReadReq ||
+                        pkt->cmd == MemCmd::WriteReq ||
+                        pkt->cmd == MemCmd::ReadExReq) &&
+        !pkt->req->isUncacheable() && !pkt->req->isLLSC() &&
+        !pkt->req->isLockedRMW();
+    if (recordWarmingAccess(pkt) && plain) {
+        memSidePort.sendFunctional(pkt);
+        return lookupLatency * clockPeriod();
+    }
+
+    // A write that misses allocates the block here, and is then written
+    // in this cache only. The caches below would have seen a writable
+    // fetch of the block instead of the write, which must not make their
+    // copies dirty.
+    if (plain && pkt->cmd == MemCmd::WriteReq) {
+        Request::Flags flags = 0;
+        if (pkt->isSecure())
+            flags.set(Request::SECURE);
+        RequestPtr req = std::make_shared<Request>(
+            pkt->getBlockAddr(blkSize), blkSize, flags,
+            pkt->req->requestorId());
+        Packet fetch_pkt(req, MemCmd::ReadExReq, blkSize);
+        fetch_pkt.allocate();
+        const Tick latency = memSidePort.sendAtomic(&fetch_pkt);
+        memSidePort.sendFunctional(pkt);
+        return latency;
+    }
+
+    return memSidePort.sendAtomic(pkt);
+}
+
+Tick
+BaseCache::recvWarmingInstall(PacketPtr pkt)
+{
+    // The caches above are installed after this one, and their fills
+    // find the block here like the requests that brought it in would
+    // have. Hand the ownership over to a writable fill, and only hand
+    // out a shared copy of a block this cache owns, or can't write.
+    CacheBlk *blk = tags->findBlock(pkt->getAddr(), pkt->isSecure());
+    const bool needs_writable = pkt->needsWritable();
+    if (blk && needs_writable)
+        blk->clearCoherenceBits(CacheBlk::DirtyBit);
+
+    const Tick latency = memSidePort.sendAtomic(pkt);
+
+    if (blk && !needs_writable &&
+        (blk->isSet(CacheBlk::DirtyBit) ||
+         !blk->isSet(CacheBlk::WritableBit))) {
+        pkt->setHasSharers();
+    }
+    return latency;
+}
+
+void
+BaseCache::startWarming()
+{
+    fatal_if(!system->isAtomicMode(),
+             "Cache %s can only be warmed up in atomic mode", name());
+    fatal_if(warmingTags, "Cache %s is already being warmed up", name());
+
+    // All the data must live in memory while warming up, as the
+    // accesses are not serviced by the cache
+    memWriteback();
+    memInvalidate();
+
+    const auto &p = dynamic_cast<const BaseCacheParams &>(params());
+    warmingTags.reset(new WarmingTags(p.size, p.assoc, blkSize));
+}
+
+void
+BaseCache::stopWarming()
+{
+    fatal_if(!warmingTags, "Cache %s is not being warmed up", name());
+
+    std::unique_ptr<WarmingTags> warmed_tags = std::move(warmingTags);
+    DPRINTF(Cache, "%s: installing %d warmed up blocks\n", __func__,
+            warmed_tags->numBlocks());
+
+    // Blocks are installed as if requested by their last requestor, from
+    // the least to the most recently used of each set, so that the
+    // replacement policy ends up with the same recency order. The fills
+    // go through the crossbars below, so that snoop filters and other
+    // caches holding the block see them, but the caches below forward
+    // them to the memory, which holds the up to date data, without
+    // accounting them as accesses. The fills are not accounted here
+    // either.
+    warmed_tags->forEachBlk([this](const WarmingTags::Entry &entry) {
+        if (tags->findBlock(entry.blkAddr, entry.isSecure))
+            return;
+
+        Request::Flags flags = 0;
+        if (entry.isSecure)
+            flags.set(Request::SECURE);
+        RequestPtr req = std::make_shared<Request>(entry.blkAddr, blkSize,
+                                                   flags, entry.requestorId);
+        // Blocks that were written are requested writable, as the write
+        // would have done, and are then installed dirty
+        const MemCmd cmd = entry.dirty ? MemCmd::ReadExReq :
+            (isReadOnly ? MemCmd::ReadCleanReq : MemCmd::ReadSharedReq);
+        Packet pkt(req, cmd, blkSize);
+        pkt.allocate();
+        pkt.setWarmingInstall();
+        memSidePort.sendAtomic(&pkt);
+
+        PacketList writebacks;
+        CacheBlk *blk = handleFill(&pkt, nullptr, writebacks, true);
+        if (entry.dirty) {
+            assert(blk->isSet(CacheBlk::WritableBit));
+            blk->setCoherenceBits(CacheBlk::DirtyBit);
+        }
+        if (blk == tempBlock) {
+            if (PacketPtr wb_pkt = evictBlock(blk))
+                writebacks.push_back(wb_pkt);
+        }
+
+        for (auto wb_pkt : writebacks)
+            wb_pkt->setWarmingInstall();
+        doWritebacksAtomic(writebacks);
+    });
+}
+
 void
 BaseCache::invalidateBlock(CacheBlk *blk)
 {
@@ -1819,6 +2032,17 @@ BaseCache::isDirty() const
         return blk.isSet(CacheBlk::DirtyBit); });
 }
 
+std::vector<Addr>
+BaseCache::dirtyBlocks() const
+{
+    std::vector<Addr> blk_addrs;
+    tags->forEachBlk([this, &blk_addrs](CacheBlk &blk) {
+        if (blk.isSet(CacheBlk::DirtyBit))
+            blk_addrs.push_back(tags->regenerateBlkAddr(&blk));
+    });
+    return blk_addrs;
+}
+
 bool
 BaseCache::coalesce() const
 {
@@ -2519,6 +2743,20 @@ BaseCache::CacheStats::regStats()
     dataContractions.flags(nozero | nonan);
 }
 
+BaseCache::ShadowTagStats::ShadowTagStats(BaseTags &tags)
+    : statistics::Group(&tags),
+    ADD_STAT(hits, statistics::units::Count::get(),
+             "number of accesses that hit in the shadow tags"),
+    ADD_STAT(misses, statistics::units::Count::get(),
+             "number of accesses that missed in the shadow tags"),
+    ADD_STAT(accesses, statistics::units::Count::get(),
+             "number of accesses to the shadow tags", hits + misses),
+    ADD_STAT(missRate, statistics::units::Ratio::get(),
+             "miss rate of the shadow tags", misses / accesses)
+{
+    missRate.flags(statistics::nonan);
+}
+
 void
 BaseCache::regProbePoints()
 {
@@ -2591,6 +2829,14 @@ BaseCache::CpuSidePort::recvAtomic(PacketPtr pkt)
     if (cache.system->bypassCaches()) {
         // Forward the request if the system is in cache bypass mode.
         return cache.memSidePort.sendAtomic(pkt);
+    } else if (pkt->isWarmingInstall()) {
+        // Blocks being installed after warming up hold the same data as
+        // the memory, which services them.
+        return cache.recvWarmingInstall(pkt);
+    } else if (cache.warmingTags) {
+        // The cache holds no blocks while warming up, so just record
+        // the access and let the memory below service it.
+        return cache.recvWarmingAtomic(pkt);
     } else {
         return cache.recvAtomic(pkt);
     }
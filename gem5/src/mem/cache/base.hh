@@ -48,7 +48,9 @@
 
 #include <cassert>
 #include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "base/addr_range.hh"
 #include "base/compiler.hh"
@@ -63,6 +65,7 @@
 #include "mem/cache/compressors/base.hh"
 #include "mem/cache/mshr_queue.hh"
 #include "mem/cache/tags/base.hh"
+#include "mem/cache/tags/warming_tags.hh"
 #include "mem/cache/write_queue.hh"
 #include "mem/cache/write_queue_entry.hh"
 #include "mem/packet.hh"
@@ -352,6 +355,19 @@ class BaseCache : public ClockedObject
     /** Tag and data Storage */
     BaseTags *tags;
 
+    /**
+     * Tag stores of alternative cache configurations that observe the
+     * same accesses as this cache, but do not hold data nor affect the
+     * cache's behaviour.
+     */
+    std::vector<BaseTags *> shadowTags;
+
+    /**
+     * Tag-only model recording the accesses while the cache is being
+     * warmed up, nullptr otherwise.
+     */
+    std::unique_ptr<WarmingTags> warmingTags;
+
     /** Compression method being used. */
     compression::Base* compressor;
 
@@ -454,6 +470,46 @@ class BaseCache : public ClockedObject
             cmd.isLLSC();
     }
 
+    /**
+     * Replay an access on every shadow tag store, allocating on misses
+     * whenever this cache would have allocated. Only the presence of the
+     * block is modelled, so coherence state and invalidations coming from
+     * other caches are ignored.
+     *
+     * @param pkt The request being serviced by this cache.
+     */
+    void accessShadowTags(const PacketPtr pkt);
+
+    /**
+     * Record an atomic request in the warming tags, allocating the
+     * block whenever this cache would have allocated it.
+     *
+     * @param pkt The request to record.
+     * @return Whether the request hit in the warming tags.
+     */
+    bool recordWarmingAccess(const PacketPtr pkt);
+
+    /**
+     * Handle an atomic request while warming up. The request is recorded
+     * and serviced by the memory below, and only requests that miss in
+     * the warming tags are visible to the caches below.
+     *
+     * @param pkt The request to handle.
+     * @return The latency of the request.
+     */
+    Tick recvWarmingAtomic(PacketPtr pkt);
+
+    /**
+     * Pass the fill of a block being installed in a cache above after
+     * warming up on to the memory below. If this cache holds the block,
+     * it hands the ownership over or keeps it, so that a single cache
+     * ends up holding the block dirty.
+     *
+     * @param pkt The fill request.
+     * @return The latency of the request.
+     */
+    Tick recvWarmingInstall(PacketPtr pkt);
+
     /**
      * Regenerate block address using tags.
      * Block address regeneration depends on whether we're using a temporary
@@ -868,6 +924,26 @@ class BaseCache : public ClockedObject
      */
     virtual void memInvalidate() override;
 
+    /**
+     * Start warming the cache up. Its contents are written back and
+     * invalidated, and until stopWarming() is called atomic requests
+     * are only recorded in tag-only warming tags before being forwarded
+     * to the memory below, which holds the up to date data. This is
+     * much cheaper than servicing them, and is meant to be used while
+     * fast-forwarding with an atomic CPU.
+     */
+    void startWarming();
+
+    /**
+     * Stop warming the cache up, and install the recorded blocks in the
+     * tags, dirty and writable if they were written to. The fills are
+     * sent through the memory system below so that the snoop filters
+     * and the other caches observe them, but no cache accounts them in
+     * its stats. The caches below must be installed first, so that they
+     * hand the ownership of the blocks written above over.
+     */
+    void stopWarming();
+
     /**
      * Determine if there are any dirty blocks in the cache.
      *
@@ -875,6 +951,14 @@ class BaseCache : public ClockedObject
      */
     bool isDirty() const;
 
+    /**
+     * Get the addresses of the dirty blocks, e.g., to check which
+     * cache owns a block.
+     *
+     * @return The block aligned address of every dirty block.
+     */
+    std::vector<Addr> dirtyBlocks() const;
+
     /**
      * Determine if an address is in the ranges covered by this
      * cache. This is useful to filter snoops.
@@ -1152,6 +1236,24 @@ class BaseCache : public ClockedObject
         std::vector<std::unique_ptr<CacheCmdStats>> cmd;
     } stats;
 
+    /** Hit and miss statistics of a shadow tag store. */
+    struct ShadowTagStats : public statistics::Group
+    {
+        ShadowTagStats(BaseTags &tags);
+
+        /** Number of accesses that found their block. */
+        statistics::Scalar hits;
+        /** Number of accesses that did not find their block. */
+        statistics::Scalar misses;
+        /** Number of accesses. */
+        statistics::Formula accesses;
+        /** The miss rate of the shadow tags. */
+        statistics::Formula missRate;
+    };
+
+    /** Statistics of each shadow tag store, merged into its own group. */
+    std::vector<std::unique_ptr<ShadowTagStats>> shadowStats;
+
     /** Registers probes. */
     void regProbePoints() override;
 
@@ -64,6 +64,21 @@ class BaseCacheCompressor(SimObject):
         "to finish decompression (e.g., due to shifting and packaging).",
     )
 
+    fast_path = Param.Bool(
+        True,
+        "Use whole-line scans to compute the compressed size of lines whose "
+        "encoding is fully determined by them (e.g., all-zero lines), "
+        "instead of matching every chunk against the patterns. The "
+        "resulting compression data only holds the compressed size, so "
+        "this is ignored when compression is debugged (DEBUG_COMPRESSION).",
+    )
+    memo_entries = Param.Unsigned(
+        0,
+        "Number of entries of the table that memoises compression results "
+        "by line contents (0 disables it). Only the generic compression "
+        "stats account for lines that hit in this table.",
+    )
+
 
 class BaseDictionaryCompressor(BaseCacheCompressor):
     type = "BaseDictionaryCompressor"
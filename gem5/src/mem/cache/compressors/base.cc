@@ -42,6 +42,7 @@
 #include "base/trace.hh"
 #include "debug/CacheComp.hh"
 #include "mem/cache/base.hh"
+#include "mem/cache/compressors/line_scan.hh"
 #include "mem/cache/tags/super_blk.hh"
 #include "params/BaseCacheCompressor.hh"
 
@@ -88,7 +89,15 @@ Base::Base(const Params &p)
     compExtraLatency(p.comp_extra_latency),
     decompChunksPerCycle(p.decomp_chunks_per_cycle),
     decompExtraLatency(p.decomp_extra_latency),
-    cache(nullptr), stats(*this)
+#ifdef DEBUG_COMPRESSION
+    // The fast path doesn't generate decompressible data, which is needed
+    // to verify the compressed lines
+    fastPath(false),
+#else
+    fastPath(p.fast_path),
+#endif
+    cache(nullptr), memoTable(p.memo_entries),
+    stats(*this)
 {
     fatal_if(64 % chunkSizeBits,
         "64 must be a multiple of the chunk granularity.");
@@ -101,6 +110,12 @@ Base::Base(const Params &p)
         "chunks in the input");
 
     fatal_if(blkSize < sizeThreshold, "Compressed data must fit in a block");
+
+    #ifdef DEBUG_COMPRESSION
+    fatal_if(!memoTable.empty(), "The memoisation table does not generate "
+        "decompressible data, and must be disabled when debugging "
+        "compression.");
+    #endif
 }
 
 void
@@ -119,11 +134,11 @@ Base::toChunks(const uint64_t* data) const
 
     // Turn a 64-bit array into a chunkSizeBits-array
     std::vector<Chunk> chunks((blkSize * CHAR_BIT) / chunkSizeBits, 0);
-    for (int i = 0; i < chunks.size(); i++) {
-        const int index_64 = std::floor(i / (double)num_chunks_per_64);
+    const uint64_t chunk_mask = mask(chunkSizeBits);
+    for (std::size_t i = 0; i < chunks.size(); i++) {
+        const std::size_t index_64 = i / num_chunks_per_64;
         const unsigned start = i % num_chunks_per_64;
-        chunks[i] = bits(data[index_64],
-            (start + 1) * chunkSizeBits - 1, start * chunkSizeBits);
+        chunks[i] = (data[index_64] >> (start * chunkSizeBits)) & chunk_mask;
     }
 
     return chunks;
@@ -138,8 +153,8 @@ Base::fromChunks(const std::vector<Chunk>& chunks, uint64_t* data) const
 
     // Turn a chunkSizeBits-array into a 64-bit array
     std::memset(data, 0, blkSize);
-    for (int i = 0; i < chunks.size(); i++) {
-        const int index_64 = std::floor(i / (double)num_chunks_per_64);
+    for (std::size_t i = 0; i < chunks.size(); i++) {
+        const std::size_t index_64 = i / num_chunks_per_64;
         const unsigned start = i % num_chunks_per_64;
         replaceBits(data[index_64], (start + 1) * chunkSizeBits - 1,
             start * chunkSizeBits, chunks[i]);
@@ -149,9 +164,38 @@ Base::fromChunks(const std::vector<Chunk>& chunks, uint64_t* data) const
 std::unique_ptr<Base::CompressionData>
 Base::compress(const uint64_t* data, Cycles& comp_lat, Cycles& decomp_lat)
 {
-    // Apply compression
-    std::unique_ptr<CompressionData> comp_data =
-        compress(toChunks(data), comp_lat, decomp_lat);
+    const std::size_t num_words = blkSize / sizeof(uint64_t);
+
+    // Look the line up in the memoisation table, if there is one
+    MemoEntry* memo_entry = nullptr;
+    uint64_t hash = 0;
+    if (!memoTable.empty()) {
+        hash = line_scan::hashLine(data, num_words);
+        memo_entry = &memoTable[hash % memoTable.size()];
+    }
+
+    std::unique_ptr<CompressionData> comp_data;
+    if (memo_entry && memo_entry->valid && (memo_entry->hash == hash) &&
+        std::equal(data, data + num_words, memo_entry->data.begin())) {
+        // Reuse the previous result. Only its size is needed
+        comp_data = std::make_unique<CompressionData>();
+        comp_data->setSizeBits(memo_entry->sizeBits);
+        comp_lat = memo_entry->compLat;
+        decomp_lat = memo_entry->decompLat;
+        stats.memoHits++;
+    } else {
+        // Apply compression
+        comp_data = compress(toChunks(data), comp_lat, decomp_lat);
+
+        if (memo_entry) {
+            memo_entry->valid = true;
+            memo_entry->hash = hash;
+            memo_entry->data.assign(data, data + num_words);
+            memo_entry->sizeBits = comp_data->getSizeBits();
+            memo_entry->compLat = comp_lat;
+            memo_entry->decompLat = decomp_lat;
+        }
+    }
 
     // If we are in debug mode apply decompression just after the compression.
     // If the results do not match, we've got an error
@@ -245,7 +289,9 @@ Base::BaseStats::BaseStats(Base& _compressor)
                 statistics::units::Bit, statistics::units::Count>::get(),
              "Average compression size"),
     ADD_STAT(decompressions, statistics::units::Count::get(),
-             "Total number of decompressions")
+             "Total number of decompressions"),
+    ADD_STAT(memoHits, statistics::units::Count::get(),
+             "Number of compressions served by the memoisation table")
 {
 }
 
@@ -268,6 +314,8 @@ Base::BaseStats::regStats()
 
     avgCompressionSizeBits.flags(statistics::total | statistics::nozero |
         statistics::nonan);
+
+    memoHits.flags(statistics::nozero);
     avgCompressionSizeBits = compressionSizeBits / compressions;
 }
 
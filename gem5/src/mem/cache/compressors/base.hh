@@ -37,6 +37,7 @@
 #define __MEM_CACHE_COMPRESSORS_BASE_HH__
 
 #include <cstdint>
+#include <vector>
 
 #include "base/compiler.hh"
 #include "base/statistics.hh"
@@ -125,9 +126,45 @@ class Base : public SimObject
      */
     const Cycles decompExtraLatency;
 
+    /**
+     * Whether whole-line scans may be used to compute the compressed size
+     * of lines without generating a decompressible representation.
+     */
+    const bool fastPath;
+
     /** Pointer to the parent cache. */
     BaseCache* cache;
 
+    /** An entry of the compression memoisation table. */
+    struct MemoEntry
+    {
+        /** Whether this entry holds a result. */
+        bool valid = false;
+
+        /** Hash of the line's contents. */
+        uint64_t hash = 0;
+
+        /** Copy of the line, used to rule out hash collisions. */
+        std::vector<uint64_t> data;
+
+        /** Compressed size, in bits, before applying the size threshold. */
+        std::size_t sizeBits = 0;
+
+        /** Compression latency. */
+        Cycles compLat = Cycles(0);
+
+        /** Decompression latency. */
+        Cycles decompLat = Cycles(0);
+    };
+
+    /**
+     * Direct-mapped table of compression results, indexed by the hash of
+     * the line's contents. It is empty if memoisation is disabled. Only
+     * compressors whose output depends exclusively on the line's contents
+     * may use it.
+     */
+    std::vector<MemoEntry> memoTable;
+
     struct BaseStats : public statistics::Group
     {
         const Base& compressor;
@@ -153,6 +190,9 @@ class Base : public SimObject
 
         /** Number of decompressions performed. */
         statistics::Scalar decompressions;
+
+        /** Number of compressions served by the memoisation table. */
+        statistics::Scalar memoHits;
     } stats;
 
     /**
@@ -120,6 +120,22 @@ class BaseDelta : public DictionaryCompressor<BaseType>
 
     void addToDictionary(DictionaryEntry data) override;
 
+    /**
+     * Compute the outcome of the compression of lines that only need the
+     * implicit zero base plus, at most, one extra base, using whole-line
+     * delta checks. The results (size, latencies and stats) are the same
+     * as the ones of the regular compression, but no patterns are stored.
+     *
+     * @param chunks The cache line to be compressed.
+     * @param comp_lat Compression latency in number of cycles.
+     * @param decomp_lat Decompression latency in number of cycles.
+     * @return The compressed line's data, or nullptr if the line needs
+     *         more bases and must go through the regular compression.
+     */
+    std::unique_ptr<Base::CompressionData> fastCompress(
+        const std::vector<Base::Chunk>& chunks,
+        Cycles& comp_lat, Cycles& decomp_lat);
+
     std::unique_ptr<Base::CompressionData> compress(
         const std::vector<Base::Chunk>& chunks,
         Cycles& comp_lat, Cycles& decomp_lat) override;
@@ -36,6 +36,7 @@
 #include "debug/CacheComp.hh"
 #include "mem/cache/compressors/base_delta.hh"
 #include "mem/cache/compressors/dictionary_compressor_impl.hh"
+#include "mem/cache/compressors/line_scan.hh"
 
 namespace gem5
 {
@@ -69,12 +70,75 @@ BaseDelta<BaseType, DeltaSizeBits>::addToDictionary(DictionaryEntry data)
         DictionaryCompressor<BaseType>::numEntries++] = data;
 }
 
+template <class BaseType, std::size_t DeltaSizeBits>
+std::unique_ptr<Base::CompressionData>
+BaseDelta<BaseType, DeltaSizeBits>::fastCompress(
+    const std::vector<Base::Chunk>& chunks, Cycles& comp_lat,
+    Cycles& decomp_lat)
+{
+    const std::size_t num_chunks = chunks.size();
+
+    // Every value before the first one that does not fit a delta to the
+    // zero base matches the zero base. That value becomes the second base,
+    // and all following values must match either base, otherwise another
+    // base would be needed, and the compression would fail
+    const std::size_t first_miss =
+        line_scan::findFirstDeltaMiss<BaseType, DeltaSizeBits>(
+        chunks.data(), num_chunks, 0);
+    std::size_t num_new_bases = 0;
+    if (first_miss < num_chunks) {
+        const BaseType base = chunks[first_miss];
+        if (line_scan::countDeltaMisses<BaseType, DeltaSizeBits>(
+                chunks.data() + first_miss, num_chunks - first_miss, base)) {
+            return nullptr;
+        }
+        num_new_bases = 1;
+    }
+
+    // Each new base is stored as an X pattern, and every other value as an
+    // M pattern
+    const DictionaryEntry zero =
+        DictionaryCompressor<BaseType>::toDictionaryEntry(0);
+    const std::size_t x_size_bits = PatternX(zero, -1).getSizeBits();
+    const std::size_t m_size_bits = PatternM(zero, 0).getSizeBits();
+    std::size_t size_bits = num_new_bases * x_size_bits +
+        (num_chunks - num_new_bases) * m_size_bits;
+
+    // Take into account the bases that have not been used, as done by the
+    // regular compression
+    size_bits += 8 * sizeof(BaseType) *
+        (DEFAULT_MAX_NUM_BASES - 1 - num_new_bases);
+
+    DictionaryCompressor<BaseType>::dictionaryStats.patterns[X] +=
+        num_new_bases;
+    DictionaryCompressor<BaseType>::dictionaryStats.patterns[M] +=
+        num_chunks - num_new_bases;
+
+    DictionaryCompressor<BaseType>::setLatencies(num_chunks, comp_lat,
+        decomp_lat);
+
+    std::unique_ptr<Base::CompressionData> comp_data =
+        DictionaryCompressor<BaseType>::instantiateDictionaryCompData();
+    comp_data->setSizeBits(size_bits);
+    DPRINTF(CacheComp, "Base%dDelta%d compressed line using %d new bases\n",
+        8 * sizeof(BaseType), DeltaSizeBits, num_new_bases);
+    return comp_data;
+}
+
 template <class BaseType, std::size_t DeltaSizeBits>
 std::unique_ptr<Base::CompressionData>
 BaseDelta<BaseType, DeltaSizeBits>::compress(
     const std::vector<Base::Chunk>& chunks, Cycles& comp_lat,
     Cycles& decomp_lat)
 {
+    if (DictionaryCompressor<BaseType>::fastPath) {
+        std::unique_ptr<Base::CompressionData> comp_data =
+            fastCompress(chunks, comp_lat, decomp_lat);
+        if (comp_data) {
+            return comp_data;
+        }
+    }
+
     std::unique_ptr<Base::CompressionData> comp_data =
         DictionaryCompressor<BaseType>::compress(chunks, comp_lat, decomp_lat);
 
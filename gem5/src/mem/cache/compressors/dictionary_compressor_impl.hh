@@ -149,16 +149,23 @@ DictionaryCompressor<T>::compress(const std::vector<Chunk>& chunks)
 }
 
 template <class T>
-std::unique_ptr<Base::CompressionData>
-DictionaryCompressor<T>::compress(const std::vector<Chunk>& chunks,
-    Cycles& comp_lat, Cycles& decomp_lat)
+void
+DictionaryCompressor<T>::setLatencies(std::size_t num_chunks,
+    Cycles& comp_lat, Cycles& decomp_lat) const
 {
     // Set latencies based on the degree of parallelization, and any extra
     // latencies due to shifting or packaging
-    comp_lat = Cycles(compExtraLatency +
-        (chunks.size() / compChunksPerCycle));
+    comp_lat = Cycles(compExtraLatency + (num_chunks / compChunksPerCycle));
     decomp_lat = Cycles(decompExtraLatency +
-        (chunks.size() / decompChunksPerCycle));
+        (num_chunks / decompChunksPerCycle));
+}
+
+template <class T>
+std::unique_ptr<Base::CompressionData>
+DictionaryCompressor<T>::compress(const std::vector<Chunk>& chunks,
+    Cycles& comp_lat, Cycles& decomp_lat)
+{
+    setLatencies(chunks.size(), comp_lat, decomp_lat);
 
     return compress(chunks);
 }
@@ -58,6 +58,8 @@ FrequentValues::FrequentValues(const Params &p)
 {
     fatal_if((numVFTEntries - 1) > mask(chunkSizeBits),
         "There are more VFT entries than possible values.");
+    fatal_if(!memoTable.empty(), "The output of the frequent values "
+        "compressor depends on its training state, so it can't be memoised.");
 }
 
 std::unique_ptr<Base::CompressionData>
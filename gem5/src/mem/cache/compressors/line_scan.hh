@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file
+ * Whole-line scans used by the compressors' fast paths.
+ *
+ * The compressors look at a line one chunk at a time, comparing it against
+ * every pattern and dictionary entry, which is slow to simulate. Many lines
+ * however have a layout (all zeros, a single repeated value, small deltas
+ * to a single base) that is fully determined by a handful of reductions over
+ * the whole line. The functions here compute those reductions with simple,
+ * branch-free loops over the chunk array so that the host compiler can turn
+ * them into SIMD code on any host ISA.
+ *
+ * All functions work on chunk arrays as produced by Base::toChunks(), where
+ * each 64-bit chunk holds a value of type T in its least significant bits.
+ */
+
+#ifndef __MEM_CACHE_COMPRESSORS_LINE_SCAN_HH__
+#define __MEM_CACHE_COMPRESSORS_LINE_SCAN_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "base/bitfield.hh"
+
+namespace gem5
+{
+
+namespace compression
+{
+
+namespace line_scan
+{
+
+/**
+ * Count the chunks whose value is equal to a given value.
+ *
+ * @param chunks The chunks to scan.
+ * @param num_chunks Number of chunks.
+ * @param value The value being searched for.
+ * @return The number of chunks equal to value.
+ */
+template <class T>
+inline std::size_t
+countEqual(const uint64_t* chunks, std::size_t num_chunks, T value)
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < num_chunks; i++) {
+        count += (static_cast<T>(chunks[i]) == value);
+    }
+    return count;
+}
+
+/**
+ * Branch-free version of DeltaPattern::isValidDelta: whether the difference
+ * between value and base fits in a signed DeltaSizeBits container.
+ */
+template <class T, std::size_t DeltaSizeBits>
+inline bool
+isValidDelta(T value, T base)
+{
+    static_assert(std::is_unsigned_v<T>, "Values must be unsigned");
+    static_assert(DeltaSizeBits < (sizeof(T) * 8),
+        "Delta size must be smaller than base size");
+
+    // delta is in [-limit, limit] iff (delta + limit) is in [0, 2 * limit]
+    // when computed in modular arithmetic, which avoids a branch
+    const T limit = DeltaSizeBits ? mask(DeltaSizeBits - 1) : 0;
+    const T delta = value - base;
+    return static_cast<T>(delta + limit) <= static_cast<T>(2 * limit);
+}
+
+/**
+ * Find the first chunk which can't be represented as a delta to a base.
+ *
+ * @param chunks The chunks to scan.
+ * @param num_chunks Number of chunks.
+ * @param base The base the deltas are calculated against.
+ * @return The index of the first chunk that does not fit, or num_chunks.
+ */
+template <class T, std::size_t DeltaSizeBits>
+inline std::size_t
+findFirstDeltaMiss(const uint64_t* chunks, std::size_t num_chunks, T base)
+{
+    for (std::size_t i = 0; i < num_chunks; i++) {
+        if (!isValidDelta<T, DeltaSizeBits>(static_cast<T>(chunks[i]),
+                base)) {
+            return i;
+        }
+    }
+    return num_chunks;
+}
+
+/**
+ * Count the chunks which can be represented neither as a delta to the zero
+ * base nor as a delta to the given base.
+ *
+ * @param chunks The chunks to scan.
+ * @param num_chunks Number of chunks.
+ * @param base The non-zero base.
+ * @return The number of chunks that need another base.
+ */
+template <class T, std::size_t DeltaSizeBits>
+inline std::size_t
+countDeltaMisses(const uint64_t* chunks, std::size_t num_chunks, T base)
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < num_chunks; i++) {
+        const T value = static_cast<T>(chunks[i]);
+        count += !(isValidDelta<T, DeltaSizeBits>(value, 0) |
+            isValidDelta<T, DeltaSizeBits>(value, base));
+    }
+    return count;
+}
+
+/**
+ * Hash the contents of a line. This is not a cryptographic hash; users
+ * must compare the contents of the lines when the hashes match.
+ *
+ * @param data The line's data.
+ * @param num_words Number of 64-bit words in the line.
+ * @return The line's hash.
+ */
+inline uint64_t
+hashLine(const uint64_t* data, std::size_t num_words)
+{
+    // Each word is salted with its position and mixed independently
+    // (multiply-xorshift), so that the only dependency between iterations
+    // is the final xor reduction
+    uint64_t hash = num_words;
+    for (std::size_t i = 0; i < num_words; i++) {
+        uint64_t word = data[i] ^ (0x9e3779b97f4a7c15ULL * (i + 1));
+        word ^= word >> 33;
+        word *= 0xff51afd7ed558ccdULL;
+        word ^= word >> 33;
+        hash ^= word;
+    }
+    hash ^= hash >> 29;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+} // namespace line_scan
+} // namespace compression
+} // namespace gem5
+
+#endif //__MEM_CACHE_COMPRESSORS_LINE_SCAN_HH__
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "mem/cache/compressors/line_scan.hh"
+
+using namespace gem5;
+using namespace gem5::compression;
+
+namespace
+{
+
+/** Reference implementation, as done by DeltaPattern::isValidDelta. */
+template <class T, std::size_t DeltaSizeBits>
+bool
+referenceIsValidDelta(T value, T base)
+{
+    const typename std::make_signed<T>::type limit = DeltaSizeBits ?
+        mask(DeltaSizeBits - 1) : 0;
+    const typename std::make_signed<T>::type delta = value - base;
+    return (delta >= -limit) && (delta <= limit);
+}
+
+} // anonymous namespace
+
+/** The branch-free delta check must match the reference on edge cases. */
+TEST(LineScanTest, IsValidDelta)
+{
+    const std::vector<uint16_t> values = {0, 1, 62, 63, 64, 65, 127, 128,
+        0x7FFF, 0x8000, 0xFF80, 0xFF81, 0xFFC0, 0xFFC1, 0xFFFE, 0xFFFF};
+    for (const auto value : values) {
+        for (const auto base : values) {
+            ASSERT_EQ((line_scan::isValidDelta<uint16_t, 8>(value, base)),
+                (referenceIsValidDelta<uint16_t, 8>(value, base)))
+                << value << " " << base;
+            ASSERT_EQ((line_scan::isValidDelta<uint16_t, 1>(value, base)),
+                (referenceIsValidDelta<uint16_t, 1>(value, base)))
+                << value << " " << base;
+        }
+    }
+
+    const uint64_t max = std::numeric_limits<uint64_t>::max();
+    ASSERT_TRUE((line_scan::isValidDelta<uint64_t, 32>(max, 0)));
+    ASSERT_TRUE((line_scan::isValidDelta<uint64_t, 32>(0x7FFFFFFF, 0)));
+    ASSERT_FALSE((line_scan::isValidDelta<uint64_t, 32>(0x80000000, 0)));
+    ASSERT_TRUE((line_scan::isValidDelta<uint64_t, 32>(
+        max - 0x7FFFFFFE, 0)));
+    ASSERT_FALSE((line_scan::isValidDelta<uint64_t, 32>(
+        max - 0x7FFFFFFF, 0)));
+}
+
+/** Count values equal to a given value. */
+TEST(LineScanTest, CountEqual)
+{
+    const std::vector<uint64_t> chunks = {0, 5, 0, 0, 5, 7, 0, 0};
+    ASSERT_EQ(line_scan::countEqual<uint64_t>(chunks.data(), 8, 0), 5u);
+    ASSERT_EQ(line_scan::countEqual<uint64_t>(chunks.data(), 8, 5), 2u);
+    ASSERT_EQ(line_scan::countEqual<uint64_t>(chunks.data(), 8, 1), 0u);
+    ASSERT_EQ(line_scan::countEqual<uint64_t>(chunks.data(), 0, 0), 0u);
+
+    // Only the bits of the value's type are compared
+    const std::vector<uint64_t> wide = {0x10000, 0x20001};
+    ASSERT_EQ(line_scan::countEqual<uint16_t>(wide.data(), 2, 0), 1u);
+}
+
+/** Find the first value that does not fit a delta. */
+TEST(LineScanTest, FindFirstDeltaMiss)
+{
+    const std::vector<uint64_t> chunks = {0, 3, 0xFF, 0x7F, 0x80, 0};
+    ASSERT_EQ((line_scan::findFirstDeltaMiss<uint16_t, 8>(
+        chunks.data(), 6, 0)), 2u);
+    ASSERT_EQ((line_scan::findFirstDeltaMiss<uint16_t, 16 - 1>(
+        chunks.data(), 6, 0)), 6u);
+    ASSERT_EQ((line_scan::findFirstDeltaMiss<uint16_t, 8>(
+        chunks.data(), 2, 0)), 2u);
+}
+
+/** Count the values that fit neither the zero base nor the given base. */
+TEST(LineScanTest, CountDeltaMisses)
+{
+    const std::vector<uint64_t> chunks = {0x1000, 0, 0x1010, 0x0FF0, 0x7F,
+        0x2000, 0x3000};
+    ASSERT_EQ((line_scan::countDeltaMisses<uint32_t, 8>(
+        chunks.data(), 5, 0x1000)), 0u);
+    ASSERT_EQ((line_scan::countDeltaMisses<uint32_t, 8>(
+        chunks.data(), 7, 0x1000)), 2u);
+    ASSERT_EQ((line_scan::countDeltaMisses<uint32_t, 8>(
+        chunks.data(), 7, 0x2000)), 4u);
+}
+
+/** Equal lines hash equally, and small changes modify the hash. */
+TEST(LineScanTest, HashLine)
+{
+    std::vector<uint64_t> line(8, 0);
+    std::vector<uint64_t> copy(line);
+    ASSERT_EQ(line_scan::hashLine(line.data(), 8),
+        line_scan::hashLine(copy.data(), 8));
+
+    const uint64_t zero_hash = line_scan::hashLine(line.data(), 8);
+    line[3] = 1;
+    const uint64_t hash_3 = line_scan::hashLine(line.data(), 8);
+    ASSERT_NE(zero_hash, hash_3);
+
+    // The position of the value matters
+    line[3] = 0;
+    line[4] = 1;
+    ASSERT_NE(hash_3, line_scan::hashLine(line.data(), 8));
+}
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/** @file
+ * Measures the throughput of the whole-line scans used by the compressors'
+ * fast paths against the per-chunk checks done by the regular dictionary
+ * based compression, on a mix of zero, repeated, narrow and random lines.
+ */
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "mem/cache/compressors/line_scan.hh"
+
+using namespace gem5;
+using namespace gem5::compression;
+
+namespace
+{
+
+constexpr std::size_t BlkSize = 64;
+constexpr std::size_t NumLines = 4096;
+constexpr unsigned NumPasses = 2000;
+
+typedef std::array<uint64_t, BlkSize / sizeof(uint64_t)> Line;
+
+/** Per-chunk dictionary entry conversion, as done by the compressors. */
+template <class T>
+T
+fromBytes(const std::array<uint8_t, sizeof(T)>& entry)
+{
+    T value = 0;
+    for (int i = sizeof(T) - 1; i >= 0; i--) {
+        value <<= 8;
+        value |= entry[i];
+    }
+    return value;
+}
+
+template <class T>
+std::array<uint8_t, sizeof(T)>
+toBytes(T value)
+{
+    std::array<uint8_t, sizeof(T)> entry;
+    for (std::size_t i = 0; i < sizeof(T); i++) {
+        entry[i] = value & 0xFF;
+        value >>= 8;
+    }
+    return entry;
+}
+
+/**
+ * Number of bases a BDI compressor needs for a line, checking each chunk
+ * against every base found so far, one at a time.
+ */
+template <class T, std::size_t DeltaSizeBits>
+std::size_t
+scalarNumBases(const std::vector<uint64_t>& chunks)
+{
+    std::vector<std::array<uint8_t, sizeof(T)>> bases = {toBytes<T>(0)};
+    for (const auto chunk : chunks) {
+        const auto bytes = toBytes<T>(chunk);
+        bool found = false;
+        for (const auto& base : bases) {
+            const typename std::make_signed<T>::type limit =
+                mask(DeltaSizeBits - 1);
+            const typename std::make_signed<T>::type delta =
+                fromBytes<T>(bytes) - fromBytes<T>(base);
+            if ((delta >= -limit) && (delta <= limit)) {
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            bases.push_back(bytes);
+        }
+    }
+    return bases.size();
+}
+
+/** Same as above, using the whole-line scans. */
+template <class T, std::size_t DeltaSizeBits>
+std::size_t
+vectorNumBases(const std::vector<uint64_t>& chunks)
+{
+    const std::size_t first = line_scan::findFirstDeltaMiss<T, DeltaSizeBits>(
+        chunks.data(), chunks.size(), 0);
+    if (first == chunks.size()) {
+        return 1;
+    }
+    return line_scan::countDeltaMisses<T, DeltaSizeBits>(
+        chunks.data() + first, chunks.size() - first, chunks[first]) ? 3 : 2;
+}
+
+std::size_t
+scalarNumZeros(const std::vector<uint64_t>& chunks)
+{
+    std::size_t count = 0;
+    for (const auto chunk : chunks) {
+        if (fromBytes<uint64_t>(toBytes<uint64_t>(chunk)) == 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
+std::size_t
+vectorNumZeros(const std::vector<uint64_t>& chunks)
+{
+    return line_scan::countEqual<uint64_t>(chunks.data(), chunks.size(), 0);
+}
+
+/** Split lines into chunks of sizeof(T) bytes. */
+template <class T>
+std::vector<std::vector<uint64_t>>
+toChunks(const std::vector<Line>& lines)
+{
+    constexpr unsigned bits = 8 * sizeof(T);
+    std::vector<std::vector<uint64_t>> all_chunks;
+    for (const auto& line : lines) {
+        std::vector<uint64_t> chunks;
+        for (const auto word : line) {
+            for (unsigned i = 0; i < 64; i += bits) {
+                chunks.push_back((word >> i) & mask(bits));
+            }
+        }
+        all_chunks.push_back(chunks);
+    }
+    return all_chunks;
+}
+
+void
+measure(const char* name,
+    const std::vector<std::vector<uint64_t>>& all_chunks,
+    std::function<std::size_t(const std::vector<uint64_t>&)> scalar,
+    std::function<std::size_t(const std::vector<uint64_t>&)> vector)
+{
+    auto run = [&](auto& func, std::size_t& checksum) {
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned pass = 0; pass < NumPasses; pass++) {
+            for (const auto& chunks : all_chunks) {
+                checksum += func(chunks);
+            }
+        }
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        return (NumPasses * all_chunks.size()) / elapsed.count();
+    };
+
+    std::size_t scalar_checksum = 0;
+    std::size_t vector_checksum = 0;
+    const double scalar_rate = run(scalar, scalar_checksum);
+    const double vector_rate = run(vector, vector_checksum);
+
+    std::printf("%-16s scalar: %12.0f lines/s  line scan: %12.0f lines/s  "
+        "speedup: %5.2fx%s\n", name, scalar_rate, vector_rate,
+        vector_rate / scalar_rate,
+        (scalar_checksum == vector_checksum) ? "" : "  (MISMATCH)");
+}
+
+} // anonymous namespace
+
+int
+main()
+{
+    // Build a mix of lines commonly found in caches
+    std::mt19937_64 rng(0);
+    std::vector<Line> lines(NumLines);
+    for (std::size_t i = 0; i < NumLines; i++) {
+        Line& line = lines[i];
+        const uint64_t base = rng();
+        for (auto& word : line) {
+            switch (i % 4) {
+              case 0: word = 0; break;
+              case 1: word = base; break;
+              case 2: word = (base & ~mask(40)) | (rng() & mask(6)); break;
+              default: word = rng(); break;
+            }
+        }
+    }
+
+    // The checksums of the scalar and line scan versions differ for lines
+    // that need more than two bases, so only compare lines that don't
+    const auto chunks_64 = toChunks<uint64_t>(lines);
+    const auto chunks_32 = toChunks<uint32_t>(lines);
+    const auto chunks_16 = toChunks<uint16_t>(lines);
+    auto cap = [](std::size_t num_bases) { return std::min<std::size_t>(
+        num_bases, 3); };
+
+    measure("Base64Delta8", chunks_64,
+        [&](const auto& c) { return cap(scalarNumBases<uint64_t, 8>(c)); },
+        vectorNumBases<uint64_t, 8>);
+    measure("Base32Delta16", chunks_32,
+        [&](const auto& c) { return cap(scalarNumBases<uint32_t, 16>(c)); },
+        vectorNumBases<uint32_t, 16>);
+    measure("Base16Delta8", chunks_16,
+        [&](const auto& c) { return cap(scalarNumBases<uint16_t, 8>(c)); },
+        vectorNumBases<uint16_t, 8>);
+    measure("Zero", chunks_64, scalarNumZeros, vectorNumZeros);
+
+    return 0;
+}
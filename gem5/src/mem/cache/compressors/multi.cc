@@ -68,6 +68,9 @@ Multi::Multi(const Params &p)
     multiStats(stats, *this)
 {
     fatal_if(compressors.size() == 0, "There must be at least one compressor");
+    fatal_if(!memoTable.empty(), "The multi compressor can't be memoised, "
+        "since its sub-compressors' stats would not be updated. Enable "
+        "memoisation on the sub-compressors instead.");
 }
 
 Multi::~Multi()
@@ -36,6 +36,7 @@
 #include "base/trace.hh"
 #include "debug/CacheComp.hh"
 #include "mem/cache/compressors/dictionary_compressor_impl.hh"
+#include "mem/cache/compressors/line_scan.hh"
 #include "params/RepeatedQwordsCompressor.hh"
 
 namespace gem5
@@ -60,13 +61,33 @@ std::unique_ptr<Base::CompressionData>
 RepeatedQwords::compress(const std::vector<Chunk>& chunks,
     Cycles& comp_lat, Cycles& decomp_lat)
 {
-    std::unique_ptr<Base::CompressionData> comp_data =
-        DictionaryCompressor::compress(chunks);
+    std::unique_ptr<Base::CompressionData> comp_data;
+    std::size_t num_values;
+    if (fastPath && line_scan::countEqual<uint64_t>(chunks.data() + 1,
+            chunks.size() - 1, chunks[0]) == chunks.size() - 1) {
+        // The whole line repeats the first value, which is an X pattern
+        // placed in the dictionary's first entry, and every other value is
+        // an M pattern. Lines with other values take the regular path, so
+        // that their patterns are accounted exactly as it does
+        const std::size_t num_matches = chunks.size() - 1;
+        num_values = 1;
+        dictionaryStats.patterns[M] += num_matches;
+        dictionaryStats.patterns[X] += num_values;
+
+        const DictionaryEntry first = toDictionaryEntry(chunks[0]);
+        comp_data = instantiateDictionaryCompData();
+        comp_data->setSizeBits(
+            num_matches * PatternM(first, 0).getSizeBits() +
+            num_values * PatternX(first, -1).getSizeBits());
+    } else {
+        comp_data = DictionaryCompressor::compress(chunks);
+        num_values = numEntries;
+    }
 
     // Since there is a single value repeated over and over, there should be
     // a single dictionary entry. If there are more, the compressor failed
-    assert(numEntries >= 1);
-    if (numEntries > 1) {
+    assert(num_values >= 1);
+    if (num_values > 1) {
         comp_data->setSizeBits(blkSize * 8);
         DPRINTF(CacheComp, "Repeated qwords compression failed\n");
     }
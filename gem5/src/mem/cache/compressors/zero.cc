@@ -36,6 +36,7 @@
 #include "base/trace.hh"
 #include "debug/CacheComp.hh"
 #include "mem/cache/compressors/dictionary_compressor_impl.hh"
+#include "mem/cache/compressors/line_scan.hh"
 #include "params/ZeroCompressor.hh"
 
 namespace gem5
@@ -60,11 +61,28 @@ std::unique_ptr<Base::CompressionData>
 Zero::compress(const std::vector<Chunk>& chunks, Cycles& comp_lat,
     Cycles& decomp_lat)
 {
-    std::unique_ptr<Base::CompressionData> comp_data =
-        DictionaryCompressor::compress(chunks);
+    std::unique_ptr<Base::CompressionData> comp_data;
+    std::size_t num_non_zeros;
+    if (fastPath) {
+        // Every zero value is a Z pattern, and every other value an X
+        const std::size_t num_zeros = line_scan::countEqual<uint64_t>(
+            chunks.data(), chunks.size(), 0);
+        num_non_zeros = chunks.size() - num_zeros;
+        dictionaryStats.patterns[Z] += num_zeros;
+        dictionaryStats.patterns[X] += num_non_zeros;
+
+        const DictionaryEntry zero = toDictionaryEntry(0);
+        comp_data = instantiateDictionaryCompData();
+        comp_data->setSizeBits(
+            num_zeros * PatternZ(zero, -1).getSizeBits() +
+            num_non_zeros * PatternX(zero, -1).getSizeBits());
+    } else {
+        comp_data = DictionaryCompressor::compress(chunks);
+        num_non_zeros = numEntries;
+    }
 
     // If there is any non-zero entry, the compressor failed
-    if (numEntries > 0) {
+    if (num_non_zeros > 0) {
         comp_data->setSizeBits(blkSize * 8);
         DPRINTF(CacheComp, "Zero compression failed\n");
     }
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/tags/warming_tags.hh"
+
+#include <algorithm>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+WarmingTags::WarmingTags(uint64_t size, unsigned assoc, unsigned blk_size)
+    : blkSize(blk_size), assoc(assoc)
+{
+    fatal_if(!isPowerOf2(blk_size), "Block size must be a power of 2");
+    fatal_if(assoc == 0 || size % (assoc * blk_size) != 0,
+             "Cache size must be a multiple of the block size times the "
+             "associativity");
+
+    sets.resize(size / (assoc * blk_size));
+}
+
+std::vector<WarmingTags::Entry>::iterator
+WarmingTags::findBlk(std::vector<Entry> &set, Addr blk_addr, bool is_secure)
+{
+    return std::find_if(set.begin(), set.end(),
+        [blk_addr, is_secure](const Entry &entry) {
+            return entry.blkAddr == blk_addr && entry.isSecure == is_secure;
+        });
+}
+
+bool
+WarmingTags::access(Addr addr, bool is_secure, RequestorID requestor_id,
+                    bool allocate, bool is_write)
+{
+    const Addr blk_addr = roundDown(addr, blkSize);
+    auto &set = sets[(blk_addr / blkSize) % sets.size()];
+
+    auto it = findBlk(set, blk_addr, is_secure);
+    if (it != set.end()) {
+        it->dirty |= is_write;
+        std::rotate(set.begin(), it, it + 1);
+        return true;
+    }
+
+    if (allocate) {
+        // Evict the least recently used block if the set is full
+        if (set.size() == assoc)
+            set.pop_back();
+        set.insert(set.begin(),
+                   Entry{blk_addr, is_secure, requestor_id, is_write});
+    }
+    return false;
+}
+
+void
+WarmingTags::clean(Addr addr, bool is_secure)
+{
+    const Addr blk_addr = roundDown(addr, blkSize);
+    auto &set = sets[(blk_addr / blkSize) % sets.size()];
+
+    auto it = findBlk(set, blk_addr, is_secure);
+    if (it != set.end())
+        it->dirty = false;
+}
+
+void
+WarmingTags::forEachBlk(std::function<void(const Entry &)> visitor) const
+{
+    for (const auto &set : sets) {
+        for (auto it = set.rbegin(); it != set.rend(); it++)
+            visitor(*it);
+    }
+}
+
+uint64_t
+WarmingTags::numBlocks() const
+{
+    uint64_t num_blocks = 0;
+    for (const auto &set : sets)
+        num_blocks += set.size();
+    return num_blocks;
+}
+
+} // namespace gem5
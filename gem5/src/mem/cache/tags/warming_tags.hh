@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a tag-only cache model used to warm caches up.
+ */
+
+#ifndef __MEM_CACHE_TAGS_WARMING_TAGS_HH__
+#define __MEM_CACHE_TAGS_WARMING_TAGS_HH__
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/request.hh"
+
+namespace gem5
+{
+
+/**
+ * A lightweight set associative LRU tag store. It holds no data and no
+ * timing information, and it is updated directly with block addresses
+ * instead of packets, so that the access stream of a fast CPU can be
+ * recorded at a fraction of the cost of going through a full cache.
+ * The recorded blocks can then be installed in the real cache.
+ */
+class WarmingTags
+{
+  public:
+    /** A block recorded by the warming tags. */
+    struct Entry
+    {
+        /** Block aligned address. */
+        Addr blkAddr;
+        /** Whether the block belongs to the secure address space. */
+        bool isSecure;
+        /** Requestor that last brought the block in. */
+        RequestorID requestorId;
+        /** Whether the block was written since it was brought in. */
+        bool dirty;
+    };
+
+    /**
+     * @param size Capacity of the modelled cache, in bytes.
+     * @param assoc Associativity of the modelled cache.
+     * @param blk_size Block size of the modelled cache, in bytes.
+     */
+    WarmingTags(uint64_t size, unsigned assoc, unsigned blk_size);
+
+    /**
+     * Record an access to a block, moving it to the most recently used
+     * position of its set.
+     *
+     * @param addr Address being accessed.
+     * @param is_secure Whether the address is secure.
+     * @param requestor_id Requestor accessing the block.
+     * @param allocate Whether to allocate the block if it is missing.
+     * @param is_write Whether the access writes the block, making it
+     *        dirty if it is present or allocated.
+     * @return Whether the block was present.
+     */
+    bool access(Addr addr, bool is_secure, RequestorID requestor_id,
+                bool allocate, bool is_write);
+
+    /**
+     * Mark a block as clean, if it is present, without updating its
+     * recency. This is used when a cache above takes the ownership of
+     * the block over.
+     *
+     * @param addr Address of the block.
+     * @param is_secure Whether the address is secure.
+     */
+    void clean(Addr addr, bool is_secure);
+
+    /**
+     * Visit every block. Blocks of a set are visited from the least to
+     * the most recently used, so that inserting them in the visiting
+     * order recreates the recency information.
+     *
+     * @param visitor Visitor to call on each block.
+     */
+    void forEachBlk(std::function<void(const Entry &)> visitor) const;
+
+    /** Number of blocks currently held. */
+    uint64_t numBlocks() const;
+
+  private:
+    /**
+     * Find a block in its set.
+     *
+     * @param set Set of the block.
+     * @param blk_addr Block aligned address of the block.
+     * @param is_secure Whether the address is secure.
+     * @return Iterator to the block, or the end of the set.
+     */
+    static std::vector<Entry>::iterator findBlk(std::vector<Entry> &set,
+                                                Addr blk_addr,
+                                                bool is_secure);
+
+    /** Block size of the modelled cache. */
+    const unsigned blkSize;
+
+    /** Associativity of the modelled cache. */
+    const unsigned assoc;
+
+    /** The blocks of every set, most recently used first. */
+    std::vector<std::vector<Entry>> sets;
+};
+
+} // namespace gem5
+
+#endif // __MEM_CACHE_TAGS_WARMING_TAGS_HH__
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "mem/cache/tags/warming_tags.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+std::vector<Addr>
+blocks(const WarmingTags &tags)
+{
+    std::vector<Addr> addrs;
+    tags.forEachBlk([&addrs](const WarmingTags::Entry &entry) {
+        addrs.push_back(entry.blkAddr);
+    });
+    return addrs;
+}
+
+} // anonymous namespace
+
+/** Accesses hit after allocation, at any offset within the block. */
+TEST(WarmingTagsTest, HitAfterAllocation)
+{
+    WarmingTags tags(1024, 2, 64);
+
+    ASSERT_FALSE(tags.access(0x1000, false, 0, true, false));
+    ASSERT_TRUE(tags.access(0x1000, false, 0, true, false));
+    ASSERT_TRUE(tags.access(0x103f, false, 0, true, false));
+    ASSERT_FALSE(tags.access(0x1040, false, 0, true, false));
+    ASSERT_EQ(tags.numBlocks(), 2u);
+}
+
+/** Non-allocating misses and secure aliases do not bring blocks in. */
+TEST(WarmingTagsTest, NoAllocate)
+{
+    WarmingTags tags(1024, 2, 64);
+
+    ASSERT_FALSE(tags.access(0x1000, false, 0, false, false));
+    ASSERT_FALSE(tags.access(0x1000, false, 0, false, false));
+    ASSERT_EQ(tags.numBlocks(), 0u);
+
+    ASSERT_FALSE(tags.access(0x1000, false, 0, true, false));
+    ASSERT_FALSE(tags.access(0x1000, true, 0, false, false));
+    ASSERT_EQ(tags.numBlocks(), 1u);
+}
+
+/** The least recently used block of a full set is evicted. */
+TEST(WarmingTagsTest, LRUEviction)
+{
+    // 4 sets of 2 ways: blocks 0x0, 0x100 and 0x200 map to set 0
+    WarmingTags tags(512, 2, 64);
+
+    tags.access(0x000, false, 0, true, false);
+    tags.access(0x100, false, 0, true, false);
+    tags.access(0x000, false, 0, true, false);
+    tags.access(0x200, false, 0, true, false);
+
+    ASSERT_TRUE(tags.access(0x000, false, 0, false, false));
+    ASSERT_FALSE(tags.access(0x100, false, 0, false, false));
+    ASSERT_TRUE(tags.access(0x200, false, 0, false, false));
+}
+
+/** Blocks are visited set by set, from least to most recently used. */
+TEST(WarmingTagsTest, VisitOrder)
+{
+    WarmingTags tags(512, 2, 64);
+
+    tags.access(0x240, false, 0, true, false);
+    tags.access(0x000, false, 0, true, false);
+    tags.access(0x100, false, 0, true, false);
+    tags.access(0x040, false, 0, true, false);
+    tags.access(0x000, false, 0, true, false);
+
+    const std::vector<Addr> expected{0x100, 0x000, 0x240, 0x040};
+    ASSERT_EQ(blocks(tags), expected);
+}
+
+/** Writes make blocks dirty until they are evicted. */
+TEST(WarmingTagsTest, Dirty)
+{
+    WarmingTags tags(512, 2, 64);
+
+    tags.access(0x000, false, 0, true, false);
+    tags.access(0x040, false, 0, true, true);
+    tags.access(0x000, false, 0, true, true);
+    tags.access(0x080, false, 0, true, false);
+    tags.access(0x080, false, 0, true, false);
+
+    std::vector<Addr> dirty;
+    tags.forEachBlk([&dirty](const WarmingTags::Entry &entry) {
+        if (entry.dirty)
+            dirty.push_back(entry.blkAddr);
+    });
+    const std::vector<Addr> expected{0x000, 0x040};
+    ASSERT_EQ(dirty, expected);
+
+    // A block brought back in after being evicted is clean
+    tags.access(0x100, false, 0, true, false);
+    tags.access(0x200, false, 0, true, false);
+    ASSERT_FALSE(tags.access(0x000, false, 0, true, false));
+    tags.forEachBlk([](const WarmingTags::Entry &entry) {
+        ASSERT_TRUE(entry.blkAddr == 0x040 || !entry.dirty);
+    });
+}
+
+/** Cleaning a block keeps it, and its position, but forgets the write. */
+TEST(WarmingTagsTest, Clean)
+{
+    WarmingTags tags(512, 2, 64);
+
+    tags.access(0x000, false, 0, true, true);
+    tags.access(0x100, false, 0, true, true);
+    tags.clean(0x010, false);
+    // Cleaning a missing block does not allocate it
+    tags.clean(0x200, false);
+    ASSERT_EQ(tags.numBlocks(), 2u);
+
+    std::vector<std::pair<Addr, bool>> blks;
+    tags.forEachBlk([&blks](const WarmingTags::Entry &entry) {
+        blks.emplace_back(entry.blkAddr, entry.dirty);
+    });
+    const std::vector<std::pair<Addr, bool>> expected{
+        {0x000, false}, {0x100, true}};
+    ASSERT_EQ(blks, expected);
+}
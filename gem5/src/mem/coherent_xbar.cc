@@ -1001,6 +1001,16 @@ void
 CoherentXBar::recvMemBackdoorReq(const MemBackdoorReq &req,
         MemBackdoorPtr &backdoor)
 {
+    // A backdoor goes straight to the memory without looking at the
+    // snoopers, which may hold a more recent (e.g. dirty) copy of the
+    // data. Only hand one out if there is nothing to snoop, or if the
+    // caches are bypassed anyway.
+    if (!snoopPorts.empty() && !system->bypassCaches()) {
+        DPRINTF(CoherentXBar, "%s: refusing backdoor for %s, %d snoopers\n",
+                __func__, req.range().to_string(), snoopPorts.size());
+        return;
+    }
+
     PortID dest_id = findPort(req.range());
     memSidePorts[dest_id]->sendMemBackdoorReq(req, backdoor);
 }
@@ -360,7 +360,12 @@ class Packet : public Printable, public Extensible<Packet>
 
         // Signal block present to squash prefetch and cache evict packets
         // through express snoop flag
-        BLOCK_CACHED          = 0x00010000
+        BLOCK_CACHED          = 0x00010000,
+
+        // Request installing a block recorded while warming a cache up (or
+        // eviction caused by it), which the caches below forward without
+        // looking it up, see BaseCache::stopWarming
+        WARMING_INSTALL       = 0x00020000
     };
 
     Flags flags;
@@ -759,6 +764,8 @@ class Packet : public Printable, public Extensible<Packet>
     void setBlockCached()          { flags.set(BLOCK_CACHED); }
     bool isBlockCached() const     { return flags.isSet(BLOCK_CACHED); }
     void clearBlockCached()        { flags.clear(BLOCK_CACHED); }
+    void setWarmingInstall()       { flags.set(WARMING_INSTALL); }
+    bool isWarmingInstall() const  { return flags.isSet(WARMING_INSTALL); }
 
     /**
      * QoS Value getter
@@ -44,11 +44,17 @@
 #include <unistd.h>
 #include <zlib.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
 #include <climits>
 #include <cstdio>
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <thread>
 
 #include "base/intmath.hh"
 #include "base/trace.hh"
@@ -76,15 +82,130 @@ namespace gem5
 namespace memory
 {
 
+namespace
+{
+
+/** Identifies a chunked physical memory checkpoint file. */
+constexpr char ChunkedStoreMagic[8] = {'g', 'e', 'm', '5', 'p', 'm', 'c', 1};
+
+/**
+ * Layout of a chunked store file: a header, followed by one index entry
+ * per chunk, followed by the data of the chunks that are not all zeros.
+ */
+struct ChunkedStoreHeader
+{
+    char magic[8];
+    uint64_t chunkSize;
+    uint64_t numChunks;
+};
+
+enum class ChunkType : uint32_t
+{
+    Zero,
+    Raw,
+    Deflate
+};
+
+struct ChunkEntry
+{
+    uint64_t offset;
+    uint64_t size;
+    ChunkType type;
+    uint32_t reserved;
+};
+
+/**
+ * Call func(i) for every i in [0, n), spreading the calls over the
+ * given number of threads.
+ */
+void
+parallelFor(uint64_t n, unsigned threads,
+            const std::function<void(uint64_t)> &func)
+{
+    std::atomic<uint64_t> next(0);
+    auto worker = [&]() {
+        for (uint64_t i = next++; i < n; i = next++)
+            func(i);
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < std::min<uint64_t>(threads, n); t++)
+        pool.emplace_back(worker);
+    worker();
+    for (auto &t : pool)
+        t.join();
+}
+
+bool
+isZero(const uint8_t *data, uint64_t size)
+{
+    // Chunks are page aligned and sized, except perhaps for the last one
+    uint64_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        if (word)
+            return false;
+    }
+    for (; i < size; i++) {
+        if (data[i])
+            return false;
+    }
+    return true;
+}
+
+bool
+writeAll(int fd, const void *data, uint64_t size, off_t offset)
+{
+    const uint8_t *buf = static_cast<const uint8_t *>(data);
+    while (size) {
+        const ssize_t written = pwrite(fd, buf, size, offset);
+        if (written <= 0)
+            return false;
+        buf += written;
+        offset += written;
+        size -= written;
+    }
+    return true;
+}
+
+bool
+readAll(int fd, void *data, uint64_t size, off_t offset)
+{
+    uint8_t *buf = static_cast<uint8_t *>(data);
+    while (size) {
+        const ssize_t bytes_read = pread(fd, buf, size, offset);
+        if (bytes_read <= 0)
+            return false;
+        buf += bytes_read;
+        offset += bytes_read;
+        size -= bytes_read;
+    }
+    return true;
+}
+
+} // anonymous namespace
+
 PhysicalMemory::PhysicalMemory(const std::string& _name,
                                const std::vector<AbstractMemory*>& _memories,
                                bool mmap_using_noreserve,
                                const std::string& shared_backstore,
-                               bool auto_unlink_shared_backstore) :
+                               bool auto_unlink_shared_backstore,
+                               uint64_t cpt_chunk_size,
+                               bool cpt_compress,
+                               bool cpt_map_chunks,
+                               unsigned cpt_threads) :
     _name(_name), size(0), mmapUsingNoReserve(mmap_using_noreserve),
     sharedBackstore(shared_backstore), sharedBackstoreSize(0),
-    pageSize(sysconf(_SC_PAGE_SIZE))
+    pageSize(sysconf(_SC_PAGE_SIZE)), cptChunkSize(cpt_chunk_size),
+    cptCompress(cpt_compress), cptMapChunks(cpt_map_chunks),
+    cptThreads(cpt_threads ? cpt_threads :
+               std::max(1U, std::thread::hardware_concurrency()))
 {
+    fatal_if(cptChunkSize % pageSize,
+             "Checkpoint chunk size %d is not a multiple of the page size\n",
+             cptChunkSize);
+
     // Register cleanup callback if requested.
     if (auto_unlink_shared_backstore && !sharedBackstore.empty()) {
         registerExitCallback([=]() { shm_unlink(shared_backstore.c_str()); });
@@ -378,6 +499,14 @@ PhysicalMemory::serializeStore(CheckpointOut &cp, unsigned int store_id,
 
     // write memory file
     std::string filepath = CheckpointIn::dir() + "/" + filename.c_str();
+
+    if (cptChunkSize) {
+        uint64_t chunk_size = cptChunkSize;
+        SERIALIZE_SCALAR(chunk_size);
+        serializeChunks(filepath, pmem, range.size());
+        return;
+    }
+
     gzFile compressed_mem = gzopen(filepath.c_str(), "wb");
     if (compressed_mem == NULL)
         fatal("Can't open physical memory checkpoint file '%s'\n",
@@ -443,11 +572,6 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(filename);
     std::string filepath = cp.getCptDir() + "/" + filename;
 
-    // mmap memoryfile
-    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
-    if (compressed_mem == NULL)
-        fatal("Can't open physical memory checkpoint file '%s'", filename);
-
     // we've already got the actual backing store mapped
     uint8_t* pmem = backingStore[store_id].pmem;
     AddrRange range = backingStore[store_id].range;
@@ -462,6 +586,17 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
         fatal("Memory range size has changed! Saw %lld, expected %lld\n",
               range_size, range.size());
 
+    // checkpoints without a chunk size hold a single gzip stream
+    uint64_t store_chunk_size;
+    if (optParamIn(cp, "chunk_size", store_chunk_size, false)) {
+        unserializeChunks(filepath, backingStore[store_id], store_chunk_size);
+        return;
+    }
+
+    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
+    if (compressed_mem == NULL)
+        fatal("Can't open physical memory checkpoint file '%s'", filename);
+
     uint64_t curr_size = 0;
     long* temp_page = new long[chunk_size];
     long* pmem_current;
@@ -491,5 +626,173 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
               filename);
 }
 
+void
+PhysicalMemory::serializeChunks(const std::string &filepath,
+                                const uint8_t *pmem, uint64_t size) const
+{
+    const uint64_t num_chunks = divCeil(size, cptChunkSize);
+
+    int fd = open(filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0664);
+    if (fd == -1)
+        fatal("Can't open physical memory checkpoint file '%s'\n",
+              filepath);
+
+    ChunkedStoreHeader header;
+    std::memcpy(header.magic, ChunkedStoreMagic, sizeof(header.magic));
+    header.chunkSize = cptChunkSize;
+    header.numChunks = num_chunks;
+
+    // The data follows the index, starting at a page boundary so that
+    // uncompressed chunks can be mapped on restore
+    std::vector<ChunkEntry> index(num_chunks);
+    uint64_t offset = roundUp(sizeof(header) + num_chunks * sizeof(ChunkEntry),
+                              pageSize);
+
+    // Compress a batch of chunks in parallel, then append them to the
+    // file in order. Batches bound the memory used for the buffers.
+    const uint64_t batch_size = 4 * cptThreads;
+    std::vector<std::unique_ptr<uint8_t[]>> buffers(batch_size);
+    for (uint64_t first = 0; first < num_chunks; first += batch_size) {
+        const uint64_t last = std::min(first + batch_size, num_chunks);
+
+        parallelFor(last - first, cptThreads, [&](uint64_t i) {
+            const uint64_t chunk = first + i;
+            const uint8_t *data = pmem + chunk * cptChunkSize;
+            const uint64_t chunk_size =
+                std::min(cptChunkSize, size - chunk * cptChunkSize);
+            ChunkEntry &entry = index[chunk];
+
+            entry.size = chunk_size;
+            entry.reserved = 0;
+            if (isZero(data, chunk_size)) {
+                entry.type = ChunkType::Zero;
+                entry.size = 0;
+                return;
+            }
+
+            entry.type = ChunkType::Raw;
+            if (!cptCompress)
+                return;
+
+            uLongf comp_size = compressBound(chunk_size);
+            if (!buffers[i])
+                buffers[i].reset(new uint8_t[compressBound(cptChunkSize)]);
+            if (compress2(buffers[i].get(), &comp_size, data, chunk_size,
+                          Z_BEST_SPEED) == Z_OK && comp_size < chunk_size) {
+                entry.type = ChunkType::Deflate;
+                entry.size = comp_size;
+            }
+        });
+
+        for (uint64_t chunk = first; chunk < last; chunk++) {
+            ChunkEntry &entry = index[chunk];
+            const uint8_t *data;
+            if (entry.type == ChunkType::Zero) {
+                entry.offset = 0;
+                continue;
+            } else if (entry.type == ChunkType::Raw) {
+                offset = roundUp(offset, pageSize);
+                data = pmem + chunk * cptChunkSize;
+            } else {
+                data = buffers[chunk - first].get();
+            }
+
+            entry.offset = offset;
+            if (!writeAll(fd, data, entry.size, offset))
+                fatal("Write failed on physical memory checkpoint file "
+                      "'%s'\n", filepath);
+            offset += entry.size;
+        }
+    }
+
+    if (!writeAll(fd, &header, sizeof(header), 0) ||
+        !writeAll(fd, index.data(), num_chunks * sizeof(ChunkEntry),
+                  sizeof(header))) {
+        fatal("Write failed on physical memory checkpoint file '%s'\n",
+              filepath);
+    }
+
+    if (close(fd))
+        fatal("Close failed on physical memory checkpoint file '%s'\n",
+              filepath);
+}
+
+void
+PhysicalMemory::unserializeChunks(const std::string &filepath,
+                                  const BackingStoreEntry &store,
+                                  uint64_t chunk_size)
+{
+    const uint64_t size = store.range.size();
+    const uint64_t num_chunks = divCeil(size, chunk_size);
+
+    int fd = open(filepath.c_str(), O_RDONLY);
+    if (fd == -1)
+        fatal("Can't open physical memory checkpoint file '%s'\n",
+              filepath);
+
+    ChunkedStoreHeader header;
+    std::vector<ChunkEntry> index(num_chunks);
+    if (!readAll(fd, &header, sizeof(header), 0) ||
+        std::memcmp(header.magic, ChunkedStoreMagic, sizeof(header.magic)) ||
+        header.chunkSize != chunk_size || header.numChunks != num_chunks ||
+        !readAll(fd, index.data(), num_chunks * sizeof(ChunkEntry),
+                 sizeof(header))) {
+        fatal("Physical memory checkpoint file '%s' is corrupted\n",
+              filepath);
+    }
+
+    // Uncompressed chunks are optionally mapped copy-on-write from the
+    // checkpoint file rather than copied, unless the backing store is
+    // shared with other processes. Note that the file must not change
+    // while the simulation runs.
+    const bool map_chunks = cptMapChunks && store.shmFd == -1 &&
+        chunk_size % pageSize == 0;
+    const int map_flags = MAP_PRIVATE | MAP_FIXED |
+        (mmapUsingNoReserve ? MAP_NORESERVE : 0);
+
+    std::atomic<uint64_t> failed_chunks(0);
+    parallelFor(num_chunks, cptThreads, [&](uint64_t chunk) {
+        const ChunkEntry &entry = index[chunk];
+        uint8_t *pmem = store.pmem + chunk * chunk_size;
+        const uint64_t len = std::min(chunk_size, size - chunk * chunk_size);
+
+        // A private backing store is freshly mapped, and thus already
+        // zero, but a shared one may hold the data of a previous user
+        if (entry.type == ChunkType::Zero) {
+            if (store.shmFd != -1)
+                std::memset(pmem, 0, len);
+            return;
+        }
+
+        if (entry.type == ChunkType::Raw) {
+            if (entry.size != len) {
+                failed_chunks++;
+            } else if (map_chunks && len % pageSize == 0 &&
+                       entry.offset % pageSize == 0 &&
+                       mmap(pmem, len, PROT_READ | PROT_WRITE, map_flags,
+                            fd, entry.offset) != MAP_FAILED) {
+                return;
+            } else if (!readAll(fd, pmem, len, entry.offset)) {
+                failed_chunks++;
+            }
+            return;
+        }
+
+        std::unique_ptr<uint8_t[]> buffer(new uint8_t[entry.size]);
+        uLongf decomp_size = len;
+        if (entry.type != ChunkType::Deflate ||
+            !readAll(fd, buffer.get(), entry.size, entry.offset) ||
+            uncompress(pmem, &decomp_size, buffer.get(),
+                       entry.size) != Z_OK || decomp_size != len) {
+            failed_chunks++;
+        }
+    });
+
+    close(fd);
+
+    fatal_if(failed_chunks, "Failed to restore %d chunks of physical memory "
+             "checkpoint file '%s'\n", failed_chunks.load(), filepath);
+}
+
 } // namespace memory
 } // namespace gem5
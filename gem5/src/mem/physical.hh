@@ -158,6 +158,19 @@ class PhysicalMemory : public Serializable
 
     long pageSize;
 
+    // Size of the chunks the backing stores are checkpointed in, or 0
+    // to checkpoint each of them as a single gzip stream
+    const uint64_t cptChunkSize;
+
+    // Whether to compress the checkpointed chunks
+    const bool cptCompress;
+
+    // Whether to map uncompressed chunks from the checkpoint on restore
+    const bool cptMapChunks;
+
+    // Number of host threads used to checkpoint and restore chunks
+    const unsigned cptThreads;
+
     // The physical memory used to provide the memory in the simulated
     // system
     std::vector<BackingStoreEntry> backingStore;
@@ -191,7 +204,11 @@ class PhysicalMemory : public Serializable
                    const std::vector<AbstractMemory*>& _memories,
                    bool mmap_using_noreserve,
                    const std::string& shared_backstore,
-                   bool auto_unlink_shared_backstore);
+                   bool auto_unlink_shared_backstore,
+                   uint64_t cpt_chunk_size,
+                   bool cpt_compress,
+                   bool cpt_map_chunks,
+                   unsigned cpt_threads);
 
     /**
      * Unmap all the backing store we have used.
@@ -296,6 +313,34 @@ class PhysicalMemory : public Serializable
      */
     void unserializeStore(CheckpointIn &cp);
 
+  private:
+
+    /**
+     * Write a backing store as a file of independent chunks. All-zero
+     * chunks are skipped, the others are compressed in parallel if
+     * compression is enabled, and are otherwise stored page aligned.
+     *
+     * @param filepath Path of the file to create
+     * @param pmem The host pointer to the backing store
+     * @param size Size of the backing store
+     */
+    void serializeChunks(const std::string &filepath, const uint8_t *pmem,
+                         uint64_t size) const;
+
+    /**
+     * Read a backing store written by serializeChunks(), decompressing
+     * chunks in parallel. Uncompressed chunks are mapped copy-on-write
+     * from the checkpoint file if enabled and the backing store is
+     * private.
+     *
+     * @param filepath Path of the file to read
+     * @param store The backing store to fill
+     * @param chunk_size Chunk size recorded in the checkpoint
+     */
+    void unserializeChunks(const std::string &filepath,
+                           const BackingStoreEntry &store,
+                           uint64_t chunk_size);
+
 };
 
 } // namespace memory
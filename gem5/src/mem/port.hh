@@ -236,7 +236,7 @@ class RequestPort: public Port, public AtomicRequestProtocol,
      *        passing the request further downstream.
      */
     void sendMemBackdoorReq(const MemBackdoorReq &req,
-            MemBackdoorPtr &backdoor);
+            MemBackdoorPtr &backdoor) const;
 
   public:
     /* The timing protocol. */
@@ -589,7 +589,7 @@ RequestPort::sendFunctional(PacketPtr pkt) const
 
 inline void
 RequestPort::sendMemBackdoorReq(const MemBackdoorReq &req,
-        MemBackdoorPtr &backdoor)
+        MemBackdoorPtr &backdoor) const
 {
     try {
         return FunctionalRequestProtocol::sendMemBackdoorReq(
@@ -37,6 +37,8 @@
 
 #include "mem/port_proxy.hh"
 
+#include <cstring>
+
 #include "base/chunk_generator.hh"
 #include "cpu/thread_context.hh"
 #include "mem/port.hh"
@@ -46,18 +48,60 @@ namespace gem5
 
 PortProxy::PortProxy(ThreadContext *tc, Addr cache_line_size) :
     PortProxy([tc](PacketPtr pkt)->void { tc->sendFunctional(pkt); },
+        [tc](const MemBackdoorReq &req, MemBackdoorPtr &backdoor)->void {
+            tc->sendMemBackdoorReq(req, backdoor);
+        },
         cache_line_size)
 {}
 
 PortProxy::PortProxy(const RequestPort &port, Addr cache_line_size) :
     PortProxy([&port](PacketPtr pkt)->void { port.sendFunctional(pkt); },
+        [&port](const MemBackdoorReq &req, MemBackdoorPtr &backdoor)->void {
+            port.sendMemBackdoorReq(req, backdoor);
+        },
         cache_line_size)
 {}
 
+MemBackdoorPtr
+PortProxy::findBackdoor(Addr addr, Request::Flags flags, uint64_t size,
+                        MemBackdoor::Flags access) const
+{
+    if (!sendMemBackdoorReq || size == 0)
+        return nullptr;
+
+    // Accesses which must be seen by the memory system as they happen
+    // can't be short circuited.
+    if (flags.isSet(Request::UNCACHEABLE | Request::STRICT_ORDER))
+        return nullptr;
+
+    const AddrRange range(addr, addr + size);
+    MemBackdoorPtr backdoor = nullptr;
+    sendMemBackdoorReq(MemBackdoorReq(range, access), backdoor);
+
+    // Anything between us and the memory which could hold a more recent
+    // copy of the data won't hand out a backdoor: caches never do, and a
+    // coherent crossbar refuses as long as it has snoopers. If we got one
+    // it is therefore authoritative for the range it covers.
+    if (!backdoor || !backdoor->ptr() || !range.isSubset(backdoor->range()))
+        return nullptr;
+    if ((access & MemBackdoor::Readable) && !backdoor->readable())
+        return nullptr;
+    if ((access & MemBackdoor::Writeable) && !backdoor->writeable())
+        return nullptr;
+    return backdoor;
+}
+
 void
 PortProxy::readBlobPhys(Addr addr, Request::Flags flags,
                         void *p, uint64_t size) const
 {
+    if (auto *backdoor = findBackdoor(addr, flags, size,
+                MemBackdoor::Readable)) {
+        std::memcpy(p, backdoor->ptr() + (addr - backdoor->range().start()),
+                    size);
+        return;
+    }
+
     for (ChunkGenerator gen(addr, size, _cacheLineSize); !gen.done();
          gen.next()) {
 
@@ -75,6 +119,13 @@ void
 PortProxy::writeBlobPhys(Addr addr, Request::Flags flags,
                          const void *p, uint64_t size) const
 {
+    if (auto *backdoor = findBackdoor(addr, flags, size,
+                MemBackdoor::Writeable)) {
+        std::memcpy(backdoor->ptr() + (addr - backdoor->range().start()), p,
+                    size);
+        return;
+    }
+
     for (ChunkGenerator gen(addr, size, _cacheLineSize); !gen.done();
          gen.next()) {
 
@@ -92,6 +143,13 @@ void
 PortProxy::memsetBlobPhys(Addr addr, Request::Flags flags,
                           uint8_t v, uint64_t size) const
 {
+    if (auto *backdoor = findBackdoor(addr, flags, size,
+                MemBackdoor::Writeable)) {
+        std::memset(backdoor->ptr() + (addr - backdoor->range().start()), v,
+                    size);
+        return;
+    }
+
     // quick and dirty...
     uint8_t *buf = new uint8_t[size];
 
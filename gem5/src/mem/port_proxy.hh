@@ -60,6 +60,7 @@
 #include <functional>
 #include <limits>
 
+#include "mem/backdoor.hh"
 #include "mem/protocol/functional.hh"
 #include "sim/byteswap.hh"
 
@@ -87,10 +88,20 @@ class PortProxy : FunctionalRequestProtocol
 {
   public:
     typedef std::function<void(PacketPtr pkt)> SendFunctionalFunc;
+    typedef std::function<void(const MemBackdoorReq &req,
+                               MemBackdoorPtr &backdoor)>
+        SendMemBackdoorReqFunc;
 
   private:
     SendFunctionalFunc sendFunctional;
 
+    /**
+     * Optional hook used to ask the memory system for a backdoor. If it
+     * isn't set, or the target doesn't provide a backdoor covering an
+     * access, the proxy falls back to functional packets.
+     */
+    SendMemBackdoorReqFunc sendMemBackdoorReq;
+
     /** Granularity of any transactions issued through this proxy. */
     const Addr _cacheLineSize;
 
@@ -102,11 +113,27 @@ class PortProxy : FunctionalRequestProtocol
         panic("Port proxies should never receive snoops.");
     }
 
+    /**
+     * Try to get a backdoor which covers the whole of the physical range
+     * [addr, addr + size) with the requested access permissions.
+     *
+     * @return The backdoor, or nullptr if the access has to use packets.
+     */
+    MemBackdoorPtr findBackdoor(Addr addr, Request::Flags flags,
+                                uint64_t size,
+                                MemBackdoor::Flags access) const;
+
   public:
     PortProxy(SendFunctionalFunc func, Addr cache_line_size) :
         sendFunctional(func), _cacheLineSize(cache_line_size)
     {}
 
+    PortProxy(SendFunctionalFunc func, SendMemBackdoorReqFunc backdoor_func,
+              Addr cache_line_size) :
+        sendFunctional(func), sendMemBackdoorReq(backdoor_func),
+        _cacheLineSize(cache_line_size)
+    {}
+
     // Helpers which create typical SendFunctionalFunc-s from other objects.
     PortProxy(ThreadContext *tc, Addr cache_line_size);
     PortProxy(const RequestPort &port, Addr cache_line_size);
@@ -0,0 +1,71 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.objects.BaseMemProbe import BaseMemProbe
+from m5.params import *
+from m5.proxy import *
+
+
+class MissRatioCurveProbe(BaseMemProbe):
+    """Sampled one-pass estimate of the hit rate of a range of LRU caches.
+
+    Attach it to the "PktRequest" probe point of a CommMonitor placed in
+    front of a cache to get the hit rate that cache would have for every
+    size in `sizes`, e.g. to replace L1/L2 size sweeps with a single run.
+    """
+
+    type = "MissRatioCurveProbe"
+    cxx_header = "mem/probes/miss_ratio_curve.hh"
+    cxx_class = "gem5::MissRatioCurveProbe"
+
+    system = Param.System(
+        Parent.any, "System to use when determining system cache line size"
+    )
+
+    line_size = Param.Unsigned(
+        Parent.cache_line_size,
+        "Cache line size in bytes (must be larger or "
+        "equal to the system's line size)",
+    )
+
+    sizes = VectorParam.MemorySize(
+        [f"{2 ** i}KiB" for i in range(14)],
+        "Cache sizes to estimate the hit rate of, in ascending order",
+    )
+
+    assoc = Param.Unsigned(
+        0, "Associativity of the modelled caches (0 for fully associative)"
+    )
+
+    sampling_rate = Param.Float(
+        0.01,
+        "Fraction of the lines (fully associative) or sets "
+        "(set associative) that are analysed",
+    )
+
+    min_sampled_sets = Param.Unsigned(
+        32, "Minimum number of sets analysed per set associative cache"
+    )
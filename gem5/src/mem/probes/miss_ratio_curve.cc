@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/probes/miss_ratio_curve.hh"
+
+#include <string>
+
+#include "params/MissRatioCurveProbe.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+std::string
+sizeName(uint64_t bytes)
+{
+    if (bytes >= (1ULL << 30) && bytes % (1ULL << 30) == 0)
+        return std::to_string(bytes >> 30) + "GiB";
+    if (bytes >= (1ULL << 20) && bytes % (1ULL << 20) == 0)
+        return std::to_string(bytes >> 20) + "MiB";
+    if (bytes >= (1ULL << 10) && bytes % (1ULL << 10) == 0)
+        return std::to_string(bytes >> 10) + "KiB";
+    return std::to_string(bytes) + "B";
+}
+
+} // anonymous namespace
+
+MissRatioCurveProbe::MissRatioCurveProbe(
+    const MissRatioCurveProbeParams &p)
+    : BaseMemProbe(p),
+      lineSize(p.line_size),
+      curve(p.sizes, p.line_size, p.assoc, p.sampling_rate,
+            p.min_sampled_sets),
+      stats(this)
+{
+    fatal_if(p.system->cacheLineSize() > p.line_size,
+             "The miss ratio curve probe must use a cache line size that "
+             "is larger or equal to the system's cache line size.");
+}
+
+MissRatioCurveProbe::MissRatioCurveProbeStats::MissRatioCurveProbeStats(
+    MissRatioCurveProbe *parent)
+    : statistics::Group(parent),
+      ADD_STAT(accesses, statistics::units::Count::get(),
+               "Sampled accesses per cache size"),
+      ADD_STAT(hits, statistics::units::Count::get(),
+               "Sampled hits per cache size"),
+      ADD_STAT(hitRate, statistics::units::Ratio::get(),
+               "Estimated hit rate per cache size",
+               hits / accesses)
+{
+    using namespace statistics;
+
+    const auto &sizes = parent->curve.getSizes();
+    accesses.init(sizes.size());
+    hits.init(sizes.size());
+    for (size_t i = 0; i < sizes.size(); i++) {
+        const std::string name = sizeName(sizes[i] * parent->lineSize);
+        accesses.subname(i, name);
+        hits.subname(i, name);
+        hitRate.subname(i, name);
+    }
+    hitRate.flags(nonan);
+}
+
+void
+MissRatioCurveProbe::handleRequest(const probing::PacketInfo &pkt_info)
+{
+    // only capturing read and write requests (which allocate in the
+    // cache)
+    if (!pkt_info.cmd.isRead() && !pkt_info.cmd.isWrite())
+        return;
+
+    using Outcome = SampledMissRatioCurve::Outcome;
+    const auto &outcomes = curve.access(pkt_info.addr / lineSize);
+    for (size_t i = 0; i < outcomes.size(); i++) {
+        if (outcomes[i] == Outcome::Unsampled)
+            continue;
+        stats.accesses[i]++;
+        if (outcomes[i] == Outcome::Hit)
+            stats.hits[i]++;
+    }
+}
+
+} // namespace gem5
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_PROBES_MISS_RATIO_CURVE_HH__
+#define __MEM_PROBES_MISS_RATIO_CURVE_HH__
+
+#include "mem/probes/base.hh"
+#include "mem/probes/sampled_mrc.hh"
+#include "sim/stats.hh"
+
+namespace gem5
+{
+
+struct MissRatioCurveProbeParams;
+
+/**
+ * Probe estimating the hit rate of a whole range of LRU caches from the
+ * requests it observes, using a SampledMissRatioCurve. The overhead is
+ * low enough to leave it enabled.
+ */
+class MissRatioCurveProbe : public BaseMemProbe
+{
+  public:
+    MissRatioCurveProbe(const MissRatioCurveProbeParams &params);
+
+  protected:
+    void handleRequest(const probing::PacketInfo &pkt_info) override;
+
+  protected:
+    /** Cache line size to simulate. */
+    const unsigned lineSize;
+
+    /** Model of the caches of every size. */
+    SampledMissRatioCurve curve;
+
+    struct MissRatioCurveProbeStats : public statistics::Group
+    {
+        MissRatioCurveProbeStats(MissRatioCurveProbe *parent);
+
+        /** Sampled accesses seen by each cache size. */
+        statistics::Vector accesses;
+
+        /** Sampled hits in each cache size. */
+        statistics::Vector hits;
+
+        /** Estimated hit rate of each cache size. */
+        statistics::Formula hitRate;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif //__MEM_PROBES_MISS_RATIO_CURVE_HH__
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/probes/sampled_mrc.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+/** Initial number of time stamps tracked by the Fenwick tree. */
+constexpr size_t InitialTreeSize = 1 << 12;
+
+} // anonymous namespace
+
+SampledMissRatioCurve::SampledMissRatioCurve(
+    const std::vector<uint64_t> &sizes_bytes, unsigned line_size,
+    unsigned assoc, double sampling_rate, unsigned min_sampled_sets)
+    : assoc(assoc),
+      samplingRate(sampling_rate),
+      outcomes(sizes_bytes.size(), Outcome::Unsampled),
+      lineThreshold(std::llround(sampling_rate * (1ULL << SampleBits))),
+      tree(InitialTreeSize, 0),
+      timeStamp(1)
+{
+    fatal_if(!isPowerOf2(line_size), "Line size must be a power of 2.");
+    fatal_if(samplingRate <= 0 || samplingRate > 1,
+             "The sampling rate must be in (0, 1].");
+    fatal_if(sizes_bytes.empty(), "At least one cache size must be provided.");
+
+    for (const auto size : sizes_bytes) {
+        fatal_if(size % (line_size * std::max(assoc, 1U)),
+                 "Cache size %d is not a multiple of the line size times "
+                 "the associativity.", size);
+        sizes.push_back(size / line_size);
+    }
+    fatal_if(!std::is_sorted(sizes.begin(), sizes.end()),
+             "Cache sizes must be given in ascending order.");
+
+    if (assoc != 0) {
+        for (const auto size : sizes) {
+            SampledCache cache;
+            cache.numSets = size / assoc;
+
+            // Small caches do not have enough sets for the sampling rate
+            // to pick a meaningful subset, so make sure a minimum number
+            // of them is always modelled
+            const double rate = std::max(samplingRate,
+                double(min_sampled_sets) / cache.numSets);
+            cache.setThreshold = std::min(1ULL << SampleBits,
+                (unsigned long long)std::llround(rate * (1ULL << SampleBits)));
+            caches.push_back(std::move(cache));
+        }
+    }
+}
+
+uint64_t
+SampledMissRatioCurve::sampleHash(uint64_t key)
+{
+    // splitmix64 finaliser, so that strided addresses and set indices
+    // are spread evenly over the sampled space
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return key;
+}
+
+uint64_t
+SampledMissRatioCurve::distinctSince(uint64_t time_stamp) const
+{
+    // Every tracked line has exactly one mark, so the lines accessed
+    // after time_stamp are all of them but those at or before it
+    uint64_t prefix = 0;
+    for (uint64_t i = time_stamp; i > 0; i -= i & -i)
+        prefix += tree[i];
+    return lastAccess.size() - prefix;
+}
+
+void
+SampledMissRatioCurve::updateTree(uint64_t time_stamp, int val)
+{
+    for (uint64_t i = time_stamp; i < tree.size(); i += i & -i)
+        tree[i] += val;
+}
+
+void
+SampledMissRatioCurve::compact()
+{
+    std::vector<std::pair<uint64_t, Addr>> order;
+    order.reserve(lastAccess.size());
+    for (const auto &entry : lastAccess)
+        order.emplace_back(entry.second, entry.first);
+    std::sort(order.begin(), order.end());
+
+    // Leave at least as many free time stamps as there are tracked
+    // lines, so that compactions are amortised over the accesses
+    const size_t num_lines = order.size();
+    tree.assign(std::max(tree.size(), 2 * (num_lines + 1)), 0);
+    for (size_t i = 0; i < num_lines; i++) {
+        lastAccess[order[i].second] = i + 1;
+        tree[i + 1] = 1;
+    }
+
+    // Linear time Fenwick tree construction
+    for (size_t i = 1; i < tree.size(); i++) {
+        const size_t parent = i + (i & -i);
+        if (parent < tree.size())
+            tree[parent] += tree[i];
+    }
+    timeStamp = num_lines + 1;
+}
+
+void
+SampledMissRatioCurve::accessFullyAssoc(Addr line)
+{
+    if ((sampleHash(line) & mask(SampleBits)) >= lineThreshold) {
+        std::fill(outcomes.begin(), outcomes.end(), Outcome::Unsampled);
+        return;
+    }
+
+    if (timeStamp >= tree.size())
+        compact();
+
+    std::fill(outcomes.begin(), outcomes.end(), Outcome::Miss);
+
+    auto [it, inserted] = lastAccess.try_emplace(line, timeStamp);
+    if (!inserted) {
+        // Scale the distance among the sampled lines to the whole stream
+        // and count a hit in every cache that is large enough to hold it
+        const double distance = distinctSince(it->second) / samplingRate;
+        auto first = std::upper_bound(sizes.begin(), sizes.end(), distance,
+            [](double dist, uint64_t size) { return dist < size; });
+        std::fill(outcomes.begin() + (first - sizes.begin()),
+                  outcomes.end(), Outcome::Hit);
+
+        updateTree(it->second, -1);
+        it->second = timeStamp;
+    }
+
+    updateTree(timeStamp, 1);
+    timeStamp++;
+}
+
+void
+SampledMissRatioCurve::accessSetAssoc(Addr line)
+{
+    for (size_t i = 0; i < caches.size(); i++) {
+        SampledCache &cache = caches[i];
+        const uint64_t set_index = line % cache.numSets;
+        if ((sampleHash(set_index) & mask(SampleBits)) >= cache.setThreshold) {
+            outcomes[i] = Outcome::Unsampled;
+            continue;
+        }
+
+        auto &set = cache.sets[set_index];
+        auto it = std::find(set.begin(), set.end(), line);
+        if (it != set.end()) {
+            outcomes[i] = Outcome::Hit;
+            std::rotate(set.begin(), it, it + 1);
+        } else {
+            outcomes[i] = Outcome::Miss;
+            if (set.size() < assoc)
+                set.push_back(line);
+            else
+                set.back() = line;
+            std::rotate(set.begin(), set.end() - 1, set.end());
+        }
+    }
+}
+
+const std::vector<SampledMissRatioCurve::Outcome> &
+SampledMissRatioCurve::access(Addr line)
+{
+    if (assoc == 0)
+        accessFullyAssoc(line);
+    else
+        accessSetAssoc(line);
+    return outcomes;
+}
+
+} // namespace gem5
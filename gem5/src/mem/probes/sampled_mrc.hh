@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_PROBES_SAMPLED_MRC_HH__
+#define __MEM_PROBES_SAMPLED_MRC_HH__
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * One-pass, sampled miss ratio curve model.
+ *
+ * Instead of re-running a simulation for every cache size of interest,
+ * this model computes the hit rate of a whole range of LRU caches of a
+ * given associativity from a single stream of line accesses. To keep the
+ * overhead low, only a pseudo-random subset of the stream is analysed:
+ *
+ * - Fully associative caches (assoc == 0) use SHARDS-style spatial
+ *   sampling: a line is tracked iff the hash of its address falls below
+ *   a threshold, and the reuse distances measured over the sampled lines
+ *   are scaled by the inverse of the sampling rate. Reuse distances are
+ *   counted with a Fenwick tree indexed by the time of last access.
+ *
+ * - Set associative caches use set sampling: for every simulated size
+ *   only a subset of the sets is modelled, each one as a small LRU stack
+ *   of assoc entries.
+ *
+ * Both modes are exact when the sampling rate is 1.
+ */
+class SampledMissRatioCurve
+{
+  public:
+    /** Outcome of an access in one of the modelled caches. */
+    enum class Outcome : uint8_t
+    {
+        Unsampled,
+        Miss,
+        Hit
+    };
+
+    /**
+     * @param sizes Size of each modelled cache in bytes, ascending.
+     * @param line_size Line size of the modelled caches.
+     * @param assoc Associativity of the modelled caches, 0 for fully
+     *        associative.
+     * @param sampling_rate Fraction of the lines or sets analysed.
+     * @param min_sampled_sets Minimum number of sets sampled per set
+     *        associative cache.
+     */
+    SampledMissRatioCurve(const std::vector<uint64_t> &sizes,
+                          unsigned line_size, unsigned assoc,
+                          double sampling_rate, unsigned min_sampled_sets);
+
+    /**
+     * Record an access to a line in every modelled cache.
+     *
+     * @param line Address of the line, in lines.
+     * @return The outcome of the access in each cache, in the order of
+     *         the sizes.
+     */
+    const std::vector<Outcome> &access(Addr line);
+
+    /** Size of each of the modelled caches, in lines. */
+    const std::vector<uint64_t> &getSizes() const { return sizes; }
+
+  protected:
+    /** Hash used to select the sampled lines and sets. */
+    static uint64_t sampleHash(uint64_t key);
+
+    /** Handle an access to a line of a fully associative cache. */
+    void accessFullyAssoc(Addr line);
+
+    /** Handle an access to a line of every set associative cache. */
+    void accessSetAssoc(Addr line);
+
+    /**
+     * Number of distinct sampled lines accessed after the given time
+     * stamp, i.e., the (unscaled) reuse distance of its owner.
+     */
+    uint64_t distinctSince(uint64_t time_stamp) const;
+
+    /** Add val to the Fenwick tree entry of the given time stamp. */
+    void updateTree(uint64_t time_stamp, int val);
+
+    /**
+     * Renumber the time stamps of the tracked lines so that they are
+     * dense again, growing the Fenwick tree if needed.
+     */
+    void compact();
+
+    /** Associativity of the modelled caches, 0 for fully associative. */
+    const unsigned assoc;
+
+    /** Fraction of the lines or sets analysed. */
+    const double samplingRate;
+
+    /** Size of each of the modelled caches, in lines, ascending. */
+    std::vector<uint64_t> sizes;
+
+    /** Outcome of the last access in each of the modelled caches. */
+    std::vector<Outcome> outcomes;
+
+    /** Number of bits of the hash compared against the thresholds. */
+    static constexpr unsigned SampleBits = 24;
+
+    /** A line is sampled iff its masked hash is below this threshold. */
+    const uint64_t lineThreshold;
+
+    /** Time stamp of the last access to every sampled line. */
+    std::unordered_map<Addr, uint64_t> lastAccess;
+
+    /**
+     * Fenwick tree with a one for every time stamp that is the last
+     * access of a tracked line.
+     */
+    std::vector<int32_t> tree;
+
+    /** Time stamp of the next sampled access. */
+    uint64_t timeStamp;
+
+    /** Sampled state of a set associative cache of a given size. */
+    struct SampledCache
+    {
+        /** Number of sets of the cache. */
+        uint64_t numSets;
+
+        /** A set is sampled iff its masked hash is below this. */
+        uint64_t setThreshold;
+
+        /** LRU stack of every sampled set, most recent first. */
+        std::unordered_map<uint64_t, std::vector<Addr>> sets;
+    };
+
+    /** One entry per element of sizes when assoc != 0. */
+    std::vector<SampledCache> caches;
+};
+
+} // namespace gem5
+
+#endif //__MEM_PROBES_SAMPLED_MRC_HH__
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "mem/probes/sampled_mrc.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Hits and sampled accesses of every modelled cache. */
+struct Counts
+{
+    std::vector<uint64_t> accesses;
+    std::vector<uint64_t> hits;
+
+    double
+    hitRate(size_t i) const
+    {
+        return double(hits[i]) / accesses[i];
+    }
+};
+
+/**
+ * Access a cyclic working set of the given number of lines, which an LRU
+ * cache only holds, after the first pass, if it is at least as large.
+ */
+Counts
+cycle(SampledMissRatioCurve &curve, Addr working_set, unsigned passes)
+{
+    using Outcome = SampledMissRatioCurve::Outcome;
+    const size_t num_sizes = curve.getSizes().size();
+    Counts counts{std::vector<uint64_t>(num_sizes),
+                  std::vector<uint64_t>(num_sizes)};
+    for (unsigned pass = 0; pass < passes; pass++) {
+        for (Addr line = 0; line < working_set; line++) {
+            const auto &outcomes = curve.access(line);
+            for (size_t i = 0; i < num_sizes; i++) {
+                counts.accesses[i] += outcomes[i] != Outcome::Unsampled;
+                counts.hits[i] += outcomes[i] == Outcome::Hit;
+            }
+        }
+    }
+    return counts;
+}
+
+} // anonymous namespace
+
+/** Without sampling, the fully associative curve is exact. */
+TEST(SampledMissRatioCurveTest, FullyAssocExact)
+{
+    SampledMissRatioCurve curve({1024, 2048, 3072, 4096}, 64, 0, 1.0, 1);
+    const std::vector<uint64_t> expected_sizes{16, 32, 48, 64};
+    ASSERT_EQ(curve.getSizes(), expected_sizes);
+
+    const Counts counts = cycle(curve, 48, 4);
+    const std::vector<uint64_t> expected_accesses{192, 192, 192, 192};
+    const std::vector<uint64_t> expected_hits{0, 0, 144, 144};
+    ASSERT_EQ(counts.accesses, expected_accesses);
+    ASSERT_EQ(counts.hits, expected_hits);
+}
+
+/**
+ * Without sampling, a set associative cache holds the working set iff
+ * each of its sets gets at most assoc of the consecutive lines.
+ */
+TEST(SampledMissRatioCurveTest, SetAssocExact)
+{
+    SampledMissRatioCurve curve({1024, 2048, 4096, 8192}, 64, 4, 1.0, 1);
+
+    const Counts counts = cycle(curve, 48, 4);
+    const std::vector<uint64_t> expected_accesses{192, 192, 192, 192};
+    const std::vector<uint64_t> expected_hits{0, 0, 144, 144};
+    ASSERT_EQ(counts.accesses, expected_accesses);
+    ASSERT_EQ(counts.hits, expected_hits);
+}
+
+/**
+ * With sampling, only a fraction of the accesses is analysed, and the
+ * scaled reuse distances still place the knee of the curve at the size
+ * of the working set.
+ */
+TEST(SampledMissRatioCurveTest, FullyAssocSampled)
+{
+    const uint64_t working_set = 1 << 14;
+    SampledMissRatioCurve curve(
+        {working_set * 64 / 2, working_set * 64 * 2}, 64, 0, 0.05, 1);
+
+    const Counts counts = cycle(curve, working_set, 8);
+    const uint64_t total = working_set * 8;
+    ASSERT_EQ(counts.accesses[0], counts.accesses[1]);
+    ASSERT_GT(counts.accesses[0], total / 40);
+    ASSERT_LT(counts.accesses[0], total / 10);
+
+    ASSERT_EQ(counts.hits[0], 0u);
+    ASSERT_DOUBLE_EQ(counts.hitRate(1), 7.0 / 8);
+}
+
+/** Set sampling analyses a subset of the sets of every cache size. */
+TEST(SampledMissRatioCurveTest, SetAssocSampled)
+{
+    const uint64_t working_set = 1 << 14;
+    SampledMissRatioCurve curve(
+        {working_set * 64 / 2, working_set * 64 * 2}, 64, 8, 0.05, 16);
+
+    const Counts counts = cycle(curve, working_set, 8);
+    const uint64_t total = working_set * 8;
+    for (size_t i = 0; i < 2; i++) {
+        ASSERT_GT(counts.accesses[i], total / 40);
+        ASSERT_LT(counts.accesses[i], total / 10);
+    }
+
+    ASSERT_EQ(counts.hits[0], 0u);
+    ASSERT_DOUBLE_EQ(counts.hitRate(1), 7.0 / 8);
+}
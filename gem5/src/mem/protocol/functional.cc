@@ -56,7 +56,7 @@ FunctionalRequestProtocol::send(
 void
 FunctionalRequestProtocol::sendMemBackdoorReq(
         FunctionalResponseProtocol *peer,
-        const MemBackdoorReq &req, MemBackdoorPtr &backdoor)
+        const MemBackdoorReq &req, MemBackdoorPtr &backdoor) const
 {
     return peer->recvMemBackdoorReq(req, backdoor);
 }
@@ -58,6 +58,8 @@ namespace gem5
 namespace ruby
 {
 
+class MessageBuffer;
+
 class Consumer
 {
   public:
@@ -70,7 +72,9 @@ class Consumer
 
     virtual void wakeup() = 0;
     virtual void print(std::ostream& out) const = 0;
-    virtual void storeEventInfo(int info) {}
+    //! Called by an input buffer of this consumer whenever a message is
+    //! enqueued into it.
+    virtual void storeEventInfo(MessageBuffer *buffer) {}
 
     bool
     alreadyScheduled(Tick time)
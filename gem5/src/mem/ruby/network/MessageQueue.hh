@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_NETWORK_MESSAGEQUEUE_HH__
+#define __MEM_RUBY_NETWORK_MESSAGEQUEUE_HH__
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include "mem/ruby/slicc_interface/Message.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * The messages of a MessageBuffer, ordered by arrival time and then by
+ * enqueue order (see operator> on MsgPtr).
+ *
+ * Messages mostly arrive in order, as most buffers have a fixed latency.
+ * Those are kept in a FIFO, so enqueueing and dequeueing them is O(1).
+ * Only messages arriving before the last one in the FIFO (e.g., recycled,
+ * randomized or reanalyzed messages) go to a binary heap, and the front of
+ * the queue is the earlier of the fronts of the FIFO and the heap.
+ */
+class MessageQueue
+{
+  public:
+    bool empty() const { return m_fifo.empty() && m_heap.empty(); }
+    size_t size() const { return m_fifo.size() + m_heap.size(); }
+
+    const MsgPtr &
+    front() const
+    {
+        return fifoFirst() ? m_fifo.front() : m_heap.front();
+    }
+
+    void
+    push(const MsgPtr &message)
+    {
+        if (m_fifo.empty() || !(m_fifo.back() > message)) {
+            m_fifo.push_back(message);
+        } else if (m_fifo.front() > message) {
+            m_fifo.push_front(message);
+        } else {
+            m_heap.push_back(message);
+            std::push_heap(m_heap.begin(), m_heap.end(),
+                           std::greater<MsgPtr>());
+        }
+    }
+
+    void
+    pop()
+    {
+        if (fifoFirst()) {
+            m_fifo.pop_front();
+        } else {
+            std::pop_heap(m_heap.begin(), m_heap.end(),
+                          std::greater<MsgPtr>());
+            m_heap.pop_back();
+        }
+    }
+
+    void
+    clear()
+    {
+        m_fifo.clear();
+        m_heap.clear();
+    }
+
+    /** Returns the i-th message, in no particular order. */
+    const MsgPtr &
+    operator[](size_t i) const
+    {
+        return i < m_fifo.size() ? m_fifo[i] : m_heap[i - m_fifo.size()];
+    }
+
+    /** Returns all the messages, in the order they will be dequeued. */
+    std::vector<MsgPtr>
+    sorted() const
+    {
+        std::vector<MsgPtr> messages(m_fifo.begin(), m_fifo.end());
+        messages.insert(messages.end(), m_heap.begin(), m_heap.end());
+        std::stable_sort(messages.begin(), messages.end(),
+                         [](const MsgPtr &l, const MsgPtr &r)
+                         { return r > l; });
+        return messages;
+    }
+
+  private:
+    bool
+    fifoFirst() const
+    {
+        return m_heap.empty() ||
+               (!m_fifo.empty() && m_heap.front() > m_fifo.front());
+    }
+
+    std::deque<MsgPtr> m_fifo;
+    std::vector<MsgPtr> m_heap;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_NETWORK_MESSAGEQUEUE_HH__
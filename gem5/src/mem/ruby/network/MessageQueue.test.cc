@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "mem/ruby/network/MessageQueue.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+namespace
+{
+
+class TestMessage : public Message
+{
+  public:
+    TestMessage(Tick time, uint64_t counter)
+        : Message(time)
+    {
+        setLastEnqueueTime(time);
+        setMsgCounter(counter);
+    }
+
+    MsgPtr
+    clone() const override
+    {
+        return std::make_shared<TestMessage>(*this);
+    }
+
+    void print(std::ostream &out) const override { out << getMsgCounter(); }
+};
+
+MsgPtr
+message(Tick time, uint64_t counter)
+{
+    return std::make_shared<TestMessage>(time, counter);
+}
+
+/** Pop all the messages, returning their counters in dequeue order. */
+std::vector<uint64_t>
+popAll(MessageQueue &queue)
+{
+    std::vector<uint64_t> counters;
+    while (!queue.empty()) {
+        counters.push_back(queue.front()->getMsgCounter());
+        queue.pop();
+    }
+    return counters;
+}
+
+} // anonymous namespace
+
+TEST(MessageQueueTest, SameTickFifo)
+{
+    MessageQueue queue;
+    EXPECT_TRUE(queue.empty());
+    for (uint64_t i = 0; i < 5; i++)
+        queue.push(message(10, i));
+    EXPECT_EQ(5u, queue.size());
+
+    EXPECT_EQ((std::vector<uint64_t>{0, 1, 2, 3, 4}), popAll(queue));
+    EXPECT_TRUE(queue.empty());
+}
+
+/** Messages arriving earlier than the last one still leave in order. */
+TEST(MessageQueueTest, OutOfOrderFallback)
+{
+    MessageQueue queue;
+    queue.push(message(10, 0));
+    queue.push(message(20, 1));
+    queue.push(message(30, 2));
+    // Between the front and the back, goes to the heap
+    queue.push(message(15, 3));
+    // Before the front
+    queue.push(message(5, 4));
+    queue.push(message(25, 5));
+    EXPECT_EQ(6u, queue.size());
+
+    EXPECT_EQ(4u, queue.front()->getMsgCounter());
+    queue.pop();
+    EXPECT_EQ(0u, queue.front()->getMsgCounter());
+    queue.pop();
+
+    // Enqueue while the heap isn't empty
+    queue.push(message(12, 6));
+    queue.push(message(40, 7));
+
+    EXPECT_EQ((std::vector<uint64_t>{6, 3, 1, 5, 2, 7}), popAll(queue));
+}
+
+/** Messages arriving at the same tick leave in enqueue order. */
+TEST(MessageQueueTest, EqualTimeTieBreak)
+{
+    MessageQueue queue;
+    queue.push(message(10, 1));
+    queue.push(message(20, 4));
+    queue.push(message(10, 3));
+    queue.push(message(10, 0));
+    queue.push(message(10, 2));
+    queue.push(message(20, 5));
+
+    std::vector<uint64_t> expected{0, 1, 2, 3, 4, 5};
+    std::vector<uint64_t> sorted;
+    for (const auto &msg : queue.sorted())
+        sorted.push_back(msg->getMsgCounter());
+    EXPECT_EQ(expected, sorted);
+    EXPECT_EQ(expected, popAll(queue));
+}
+
+/** Compare against a sorted reference over random pushes and pops. */
+TEST(MessageQueueTest, Random)
+{
+    MessageQueue queue;
+    std::set<std::pair<Tick, uint64_t>> reference;
+    std::mt19937 rng(1);
+    Tick now = 0;
+
+    for (uint64_t i = 0; i < 100000; i++) {
+        if (rng() % 3 || reference.empty()) {
+            // Mostly in order, with a few messages arriving early and
+            // many at the same tick.
+            Tick time = now + rng() % 4;
+            if (rng() % 8 == 0 && time >= 8)
+                time -= rng() % 8;
+            queue.push(message(time, i));
+            reference.emplace(time, i);
+        } else {
+            ASSERT_EQ(reference.begin()->second,
+                      queue.front()->getMsgCounter());
+            queue.pop();
+            reference.erase(reference.begin());
+            if (!reference.empty())
+                now = reference.begin()->first;
+        }
+        ASSERT_EQ(reference.size(), queue.size());
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/ruby/network/garnet/AnalyticLink.hh"
+
+#include <algorithm>
+#include <cmath>
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+namespace garnet
+{
+
+void
+AnalyticLink::updateWindow(Cycles now, Cycles window, double max_utilization)
+{
+    if (now < m_window_start + window)
+        return;
+
+    // A link idle for several windows averages over all of them
+    Cycles elapsed = now - m_window_start;
+    m_utilization = std::min((double)m_window_flits / elapsed,
+                             max_utilization);
+    if (m_window_packets > 0)
+        m_flits_per_packet = (double)m_window_flits / m_window_packets;
+
+    m_window_start = now;
+    m_window_flits = 0;
+    m_window_packets = 0;
+}
+
+void
+AnalyticLink::addPacket(int num_flits)
+{
+    m_window_flits += num_flits;
+    m_window_packets++;
+}
+
+/*
+ * Mean waiting time of an M/D/1 queue, where the service time of a packet
+ * is its length in flits.
+ */
+Cycles
+AnalyticLink::queueingDelay() const
+{
+    double rho = m_utilization;
+    return Cycles(std::lround(rho * m_flits_per_packet / (2 * (1 - rho))));
+}
+
+} // namespace garnet
+} // namespace ruby
+} // namespace gem5
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_NETWORK_GARNET_0_ANALYTICLINK_HH__
+#define __MEM_RUBY_NETWORK_GARNET_0_ANALYTICLINK_HH__
+
+#include <cstdint>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+namespace garnet
+{
+
+/*
+ * A link of the analytic model. The link serves one flit per cycle, and
+ * delays the packets crossing it by the mean waiting time of an M/D/1
+ * queue with the utilization and packet length it saw over the previous
+ * window.
+ */
+class AnalyticLink
+{
+  public:
+    void setLatency(Cycles latency) { m_latency = latency; }
+    Cycles getLatency() const { return m_latency; }
+
+    // Utilization measured over the previous window
+    double getUtilization() const { return m_utilization; }
+
+    /*
+     * Measure the utilization and the packet length of the window that
+     * ended by now, if any, and start a new one. The utilization is
+     * capped to max_utilization, below 1, to keep the delay finite.
+     */
+    void updateWindow(Cycles now, Cycles window, double max_utilization);
+
+    // Account for a packet of num_flits flits crossing the link
+    void addPacket(int num_flits);
+
+    // Queueing delay of a packet crossing the link now
+    Cycles queueingDelay() const;
+
+  private:
+    Cycles m_latency;
+    Cycles m_window_start;
+    uint64_t m_window_flits = 0;
+    uint64_t m_window_packets = 0;
+
+    // Measured over the previous window
+    double m_utilization = 0;
+    double m_flits_per_packet = 1;
+};
+
+} // namespace garnet
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_NETWORK_GARNET_0_ANALYTICLINK_HH__
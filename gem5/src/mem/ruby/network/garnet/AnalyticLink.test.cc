@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include "mem/ruby/network/garnet/AnalyticLink.hh"
+
+using namespace gem5;
+using namespace gem5::ruby::garnet;
+
+/** An idle link does not delay packets. */
+TEST(AnalyticLinkTest, Idle)
+{
+    AnalyticLink link;
+    link.updateWindow(Cycles(100), Cycles(100), 0.9);
+    ASSERT_EQ(link.getUtilization(), 0);
+    ASSERT_EQ(link.queueingDelay(), Cycles(0));
+}
+
+/**
+ * The delay is the mean waiting time of an M/D/1 queue, rho * S /
+ * (2 * (1 - rho)), with the packet length as the service time S.
+ */
+TEST(AnalyticLinkTest, MD1Delay)
+{
+    AnalyticLink link;
+    // 10 packets of 4 flits in 80 cycles: rho = 0.5, S = 4
+    for (int i = 0; i < 10; i++)
+        link.addPacket(4);
+    link.updateWindow(Cycles(80), Cycles(80), 0.9);
+    ASSERT_DOUBLE_EQ(link.getUtilization(), 0.5);
+    ASSERT_EQ(link.queueingDelay(), Cycles(2));
+
+    // 15 packets of 4 flits in the next 80 cycles: rho = 0.75, S = 4
+    for (int i = 0; i < 15; i++)
+        link.addPacket(4);
+    link.updateWindow(Cycles(160), Cycles(80), 0.9);
+    ASSERT_DOUBLE_EQ(link.getUtilization(), 0.75);
+    ASSERT_EQ(link.queueingDelay(), Cycles(6));
+}
+
+/** The measurements only change once a window is over. */
+TEST(AnalyticLinkTest, Window)
+{
+    AnalyticLink link;
+    for (int i = 0; i < 50; i++)
+        link.addPacket(1);
+    link.updateWindow(Cycles(99), Cycles(100), 0.9);
+    ASSERT_EQ(link.getUtilization(), 0);
+
+    // A window that ends late averages over all the elapsed cycles
+    link.updateWindow(Cycles(200), Cycles(100), 0.9);
+    ASSERT_DOUBLE_EQ(link.getUtilization(), 0.25);
+}
+
+/** The utilization is capped so that the delay stays finite. */
+TEST(AnalyticLinkTest, Saturation)
+{
+    AnalyticLink link;
+    for (int i = 0; i < 200; i++)
+        link.addPacket(1);
+    link.updateWindow(Cycles(100), Cycles(100), 0.8);
+    ASSERT_DOUBLE_EQ(link.getUtilization(), 0.8);
+    ASSERT_EQ(link.queueingDelay(), Cycles(2));
+}
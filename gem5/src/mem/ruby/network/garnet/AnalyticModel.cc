@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/ruby/network/garnet/AnalyticModel.hh"
+
+#include "base/logging.hh"
+#include "mem/ruby/network/garnet/GarnetNetwork.hh"
+#include "mem/ruby/network/garnet/Router.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+namespace garnet
+{
+
+AnalyticModel::AnalyticModel(GarnetNetwork *net_ptr, Cycles window,
+                             double max_utilization)
+    : m_net_ptr(net_ptr), m_window(window),
+      m_max_utilization(max_utilization)
+{
+    fatal_if(m_window == 0, "The analytic model window must not be empty");
+    fatal_if(m_max_utilization <= 0 || m_max_utilization >= 1,
+             "The analytic model utilization bound must be in (0, 1)");
+}
+
+void
+AnalyticModel::addInjectionLink(NodeID ni, SwitchID router, int inport,
+                                Cycles latency)
+{
+    InjectionPort &port =
+        m_injection_ports[((uint64_t)ni << 32) | router];
+    port.link.setLatency(latency);
+    port.inport = inport;
+}
+
+void
+AnalyticModel::addRouterLink(SwitchID src, int outport, SwitchID dest,
+                             int inport, Cycles latency)
+{
+    if (src >= m_out_ports.size())
+        m_out_ports.resize(src + 1);
+    if (outport >= m_out_ports[src].size())
+        m_out_ports[src].resize(outport + 1);
+
+    OutPort &port = m_out_ports[src][outport];
+    port.link.setLatency(latency);
+    port.dest_router = dest;
+    port.dest_inport = inport;
+}
+
+void
+AnalyticModel::addEjectionLink(SwitchID src, int outport, NodeID ni,
+                               Cycles latency)
+{
+    addRouterLink(src, outport, ni, 0, latency);
+    m_out_ports[src][outport].dest_router = -1;
+}
+
+Cycles
+AnalyticModel::packetLatency(const RouteInfo &route, NodeID src_ni,
+                             int num_flits, Cycles now, int &hops)
+{
+    const std::vector<Hop> &route_hops = getRoute(route, src_ni);
+
+    // One cycle for the NI to send the head flit, which the body flits
+    // follow one cycle apart
+    Cycles latency(num_flits);
+    for (auto &hop : route_hops) {
+        AnalyticLink &link = *hop.link;
+        link.updateWindow(now, m_window, m_max_utilization);
+        latency += hop.router_latency + link.getLatency() +
+                   link.queueingDelay();
+        link.addPacket(num_flits);
+    }
+
+    // The injection link is not preceded by a router
+    hops = route_hops.size() - 2;
+    return latency;
+}
+
+/*
+ * Walk the routers from the source to the destination NI, asking each
+ * routing unit for the output port as a head flit would. The route is
+ * computed once per source, destination and vnet.
+ */
+const std::vector<AnalyticModel::Hop> &
+AnalyticModel::getRoute(const RouteInfo &route, NodeID src_ni)
+{
+    uint64_t key = ((uint64_t)src_ni << 48) |
+                   ((uint64_t)route.src_router << 32) |
+                   ((uint64_t)route.dest_ni << 16) | route.vnet;
+    auto it = m_routes.find(key);
+    if (it != m_routes.end())
+        return it->second;
+
+    auto port_it =
+        m_injection_ports.find(((uint64_t)src_ni << 32) | route.src_router);
+    fatal_if(port_it == m_injection_ports.end(),
+             "NI %d is not connected to router %d", src_ni,
+             route.src_router);
+
+    std::vector<Hop> &hops = m_routes[key];
+    hops.push_back({&port_it->second.link, Cycles(0)});
+
+    int router_id = route.src_router;
+    int inport = port_it->second.inport;
+    while (true) {
+        fatal_if(hops.size() > m_out_ports.size() + 1,
+                 "Route from NI %d to NI %d does not reach its destination",
+                 src_ni, route.dest_ni);
+
+        Router *router = m_net_ptr->getRouter(router_id);
+        int outport = router->route_compute(route, inport,
+            router->getInportDirection(inport));
+        OutPort &port = m_out_ports[router_id][outport];
+        hops.push_back({&port.link, router->get_pipe_stages()});
+
+        if (port.dest_router < 0)
+            break;
+        router_id = port.dest_router;
+        inport = port.dest_inport;
+    }
+
+    return hops;
+}
+
+} // namespace garnet
+} // namespace ruby
+} // namespace gem5
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_NETWORK_GARNET_0_ANALYTICMODEL_HH__
+#define __MEM_RUBY_NETWORK_GARNET_0_ANALYTICMODEL_HH__
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/ruby/common/TypeDefines.hh"
+#include "mem/ruby/network/garnet/AnalyticLink.hh"
+#include "mem/ruby/network/garnet/CommonTypes.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+namespace garnet
+{
+
+class GarnetNetwork;
+
+/*
+ * Analytic latency model used instead of the router pipelines when
+ * GarnetNetwork.analytic_model is set. Packets are not broken into flits
+ * and never enter the routers. Instead, the route of a packet is computed
+ * once with the routing units of the routers, and the packet is delivered
+ * to the destination NI after the zero-load latency of that route plus the
+ * queueing delay of every link it crosses (see AnalyticLink).
+ */
+class AnalyticModel
+{
+  public:
+    AnalyticModel(GarnetNetwork *net_ptr, Cycles window,
+                  double max_utilization);
+
+    // Methods used by GarnetNetwork to describe the topology
+    void addInjectionLink(NodeID ni, SwitchID router, int inport,
+                          Cycles latency);
+    void addRouterLink(SwitchID src, int outport, SwitchID dest, int inport,
+                       Cycles latency);
+    void addEjectionLink(SwitchID src, int outport, NodeID ni,
+                         Cycles latency);
+
+    /*
+     * Returns the latency of a packet of num_flits flits injected now,
+     * and accounts for its flits on the links of its route. The number of
+     * routers traversed minus one is returned in hops, as for flits.
+     */
+    Cycles packetLatency(const RouteInfo &route, NodeID src_ni,
+                         int num_flits, Cycles now, int &hops);
+
+  private:
+    struct OutPort
+    {
+        AnalyticLink link;
+        // Downstream router and its input port, or -1 for an NI
+        int dest_router;
+        int dest_inport;
+    };
+
+    struct InjectionPort
+    {
+        AnalyticLink link;
+        int inport;
+    };
+
+    struct Hop
+    {
+        AnalyticLink *link;
+        Cycles router_latency;
+    };
+
+    const std::vector<Hop> &getRoute(const RouteInfo &route,
+                                     NodeID src_ni);
+
+    GarnetNetwork *m_net_ptr;
+    const Cycles m_window;
+    const double m_max_utilization;
+
+    // Indexed by router and output port
+    std::vector<std::vector<OutPort>> m_out_ports;
+    // Indexed by (NI << 32 | router)
+    std::unordered_map<uint64_t, InjectionPort> m_injection_ports;
+    // Routes already computed, see getRoute()
+    std::unordered_map<uint64_t, std::vector<Hop>> m_routes;
+};
+
+} // namespace garnet
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_NETWORK_GARNET_0_ANALYTICMODEL_HH__
@@ -31,19 +31,23 @@
 
 #include "mem/ruby/network/garnet/GarnetNetwork.hh"
 
+#include <algorithm>
 #include <cassert>
 
 #include "base/cast.hh"
 #include "base/compiler.hh"
+#include "base/logging.hh"
 #include "debug/RubyNetwork.hh"
 #include "mem/ruby/common/NetDest.hh"
 #include "mem/ruby/network/MessageBuffer.hh"
+#include "mem/ruby/network/garnet/AnalyticModel.hh"
 #include "mem/ruby/network/garnet/CommonTypes.hh"
 #include "mem/ruby/network/garnet/CreditLink.hh"
 #include "mem/ruby/network/garnet/GarnetLink.hh"
 #include "mem/ruby/network/garnet/NetworkInterface.hh"
 #include "mem/ruby/network/garnet/NetworkLink.hh"
 #include "mem/ruby/network/garnet/Router.hh"
+#include "mem/ruby/network/garnet/flit.hh"
 #include "mem/ruby/system/RubySystem.hh"
 
 namespace gem5
@@ -62,7 +66,10 @@ namespace garnet
  */
 
 GarnetNetwork::GarnetNetwork(const Params &p)
-    : Network(p)
+    : Network(p), m_num_threads(p.num_threads),
+      m_evaluate_event([this]{ evaluateRouters(); },
+                       name() + ".evaluate", false, EVALUATE_EV_PRI),
+      m_epoch(0), m_busy_workers(0), m_terminate(false)
 {
     m_num_rows = p.num_rows;
     m_ni_flit_size = p.ni_flit_size;
@@ -76,6 +83,11 @@ GarnetNetwork::GarnetNetwork(const Params &p)
     if (m_enable_fault_model)
         fault_model = p.fault_model;
 
+    if (p.analytic_model) {
+        m_analytic_model = std::make_unique<AnalyticModel>(this,
+            p.analytic_window, p.analytic_max_utilization);
+    }
+
     m_vnet_type.resize(m_virtual_networks);
 
     for (int i = 0 ; i < m_virtual_networks ; i++) {
@@ -107,6 +119,11 @@ GarnetNetwork::GarnetNetwork(const Params &p)
     inform("Garnet version %s\n", garnetVersion);
 }
 
+GarnetNetwork::~GarnetNetwork()
+{
+    stopWorkers();
+}
+
 void
 GarnetNetwork::init()
 {
@@ -150,6 +167,155 @@ GarnetNetwork::init()
             router->printFaultVector(std::cout);
         }
     }
+
+    // Split the routers into blocks of consecutive ids, one per thread.
+    // Mesh routers are numbered row by row, so each block is a band of
+    // rows and most links stay within a partition.
+    m_num_threads = std::min<uint32_t>(m_num_threads, m_routers.size());
+    if (isLockstep()) {
+        m_active_partitions.resize(m_num_threads);
+        for (int i = 0; i < m_routers.size(); i++) {
+            m_routers[i]->set_partition(i * m_num_threads /
+                                        m_routers.size());
+        }
+    }
+}
+
+DrainState
+GarnetNetwork::drain()
+{
+    // Routers are only evaluated from m_evaluate_event, so the workers
+    // are idle here. They are restarted by the next evaluation.
+    stopWorkers();
+
+    // Routers woken up in this cycle still have to be evaluated
+    if (m_evaluate_event.scheduled() || !m_active_routers.empty())
+        return DrainState::Draining;
+    return DrainState::Drained;
+}
+
+/*
+ * Called by a router that woke up while running with more than one thread.
+ * The router is evaluated later in the cycle by evaluateRouters().
+ */
+void
+GarnetNetwork::scheduleRouter(Router *router)
+{
+    if (router->is_evaluation_pending())
+        return;
+
+    router->set_evaluation_pending(true);
+    m_active_routers.push_back(router);
+    if (!m_evaluate_event.scheduled())
+        schedule(m_evaluate_event, curTick());
+}
+
+void
+GarnetNetwork::evaluateRouters()
+{
+    for (auto router : m_active_routers) {
+        m_active_partitions[router->get_partition()].push_back(router);
+    }
+
+    // The routers trace with RubyNetwork, and the trace of the workers
+    // would interleave, so all partitions are evaluated here in order
+    // while it is enabled. The results are the same either way.
+    const bool parallel = m_num_threads > 1 && !debug::RubyNetwork;
+
+    // Release the workers and evaluate the first partition here
+    if (parallel) {
+        if (m_workers.empty())
+            startWorkers();
+        {
+            std::lock_guard<std::mutex> lock(m_worker_mutex);
+            m_busy_workers = m_workers.size();
+            m_epoch++;
+        }
+        m_start_cv.notify_all();
+    }
+    evaluatePartition(0);
+    if (parallel) {
+        std::unique_lock<std::mutex> lock(m_worker_mutex);
+        m_done_cv.wait(lock, [this]{ return m_busy_workers == 0; });
+    } else {
+        for (int i = 1; i < m_active_partitions.size(); i++)
+            evaluatePartition(i);
+    }
+
+    // Routers only read their input links and write their own buffers
+    // while they are evaluated, so the wakeups they requested are the
+    // only effects left to apply. Apply them in wakeup order.
+    for (auto router : m_active_routers) {
+        router->set_evaluation_pending(false);
+        router->commit_wakeups();
+    }
+    m_active_routers.clear();
+
+    if (drainState() == DrainState::Draining) {
+        stopWorkers();
+        signalDrainDone();
+    }
+}
+
+void
+GarnetNetwork::evaluatePartition(int partition)
+{
+    for (auto router : m_active_partitions[partition]) {
+        router->evaluate();
+    }
+    m_active_partitions[partition].clear();
+}
+
+void
+GarnetNetwork::workerMain(int partition, uint64_t epoch)
+{
+    // Share the network's event queue so that curTick() and the clock
+    // helpers of the routers work as they do on the main thread
+    curEventQueue(eventQueue());
+
+    std::unique_lock<std::mutex> lock(m_worker_mutex);
+    while (true) {
+        m_start_cv.wait(lock, [&]{ return m_terminate || m_epoch != epoch; });
+        if (m_terminate) {
+            flit::releaseFreeLists();
+            return;
+        }
+        epoch = m_epoch;
+
+        lock.unlock();
+        evaluatePartition(partition);
+        lock.lock();
+
+        if (--m_busy_workers == 0)
+            m_done_cv.notify_one();
+    }
+}
+
+void
+GarnetNetwork::startWorkers()
+{
+    assert(m_workers.empty());
+    // The workers wait for the epoch to move past the current one, which
+    // may happen before they get to run
+    m_terminate = false;
+    for (int i = 1; i < m_num_threads; i++)
+        m_workers.emplace_back(&GarnetNetwork::workerMain, this, i, m_epoch);
+}
+
+void
+GarnetNetwork::stopWorkers()
+{
+    if (m_workers.empty())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_worker_mutex);
+        m_terminate = true;
+    }
+    m_start_cv.notify_all();
+    for (auto &worker : m_workers)
+        worker.join();
+    m_workers.clear();
 }
 
 /*
@@ -208,6 +374,11 @@ GarnetNetwork::makeExtInLink(NodeID global_src, SwitchID dest, BasicLink* link,
             m_routers[dest]->get_vc_per_vnet());
     }
 
+    if (isAnalytic()) {
+        m_analytic_model->addInjectionLink(local_src, dest,
+            m_routers[dest]->get_num_inports(), net_link->getLatency());
+    }
+
     if (garnet_link->intBridgeEn) {
         DPRINTF(RubyNetwork, "Enable internal bridge for %s\n",
             garnet_link->name());
@@ -278,6 +449,12 @@ GarnetNetwork::makeExtOutLink(SwitchID src, NodeID global_dest,
         m_nis[local_dest]->addInPort(net_link, credit_link);
     }
 
+    if (isAnalytic()) {
+        m_analytic_model->addEjectionLink(src,
+            m_routers[src]->get_num_outports(), local_dest,
+            net_link->getLatency());
+    }
+
     if (garnet_link->intBridgeEn) {
         DPRINTF(RubyNetwork, "Enable internal bridge for %s\n",
             garnet_link->name());
@@ -336,6 +513,12 @@ GarnetNetwork::makeInternalLink(SwitchID src, SwitchID dest, BasicLink* link,
      * bridge is enabled, we would connect:
      * Router--->NetworkBridge--->GarnetIntLink---->Router
      */
+    if (isAnalytic()) {
+        m_analytic_model->addRouterLink(src,
+            m_routers[src]->get_num_outports(), dest,
+            m_routers[dest]->get_num_inports(), net_link->getLatency());
+    }
+
     if (garnet_link->dstBridgeEn) {
         DPRINTF(RubyNetwork, "Enable destination bridge for %s\n",
             garnet_link->name());
@@ -381,6 +564,12 @@ GarnetNetwork::get_router_id(int global_ni, int vnet)
     return m_nis[local_ni]->get_router_id(vnet);
 }
 
+NetworkInterface *
+GarnetNetwork::getNetworkInterface(NodeID global_ni)
+{
+    return m_nis[getLocalNodeID(global_ni)];
+}
+
 void
 GarnetNetwork::regStats()
 {
@@ -32,7 +32,11 @@
 #ifndef __MEM_RUBY_NETWORK_GARNET_0_GARNETNETWORK_HH__
 #define __MEM_RUBY_NETWORK_GARNET_0_GARNETNETWORK_HH__
 
+#include <condition_variable>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "mem/ruby/network/Network.hh"
@@ -52,6 +56,7 @@ class NetDest;
 namespace garnet
 {
 
+class AnalyticModel;
 class NetworkInterface;
 class Router;
 class NetworkLink;
@@ -63,10 +68,12 @@ class GarnetNetwork : public Network
   public:
     typedef GarnetNetworkParams Params;
     GarnetNetwork(const Params &p);
-    ~GarnetNetwork() = default;
+    ~GarnetNetwork();
 
     void init();
 
+    DrainState drain() override;
+
     const char *garnetVersion = "3.0";
 
     // Configuration (set externally)
@@ -94,6 +101,11 @@ class GarnetNetwork : public Network
     }
     int getNumRouters();
     int get_router_id(int ni, int vnet);
+    Router *getRouter(SwitchID id) { return m_routers[id]; }
+    NetworkInterface *getNetworkInterface(NodeID global_ni);
+
+    bool isAnalytic() const { return m_analytic_model != nullptr; }
+    AnalyticModel *getAnalyticModel() { return m_analytic_model.get(); }
 
 
     // Methods used by Topology to setup the network
@@ -157,6 +169,10 @@ class GarnetNetwork : public Network
     void update_traffic_distribution(RouteInfo route);
     int getNextPacketID() { return m_next_packet_id++; }
 
+    // Lock-step router evaluation
+    bool isLockstep() const { return m_num_threads > 0; }
+    void scheduleRouter(Router *router);
+
   protected:
     // Configuration
     int m_num_rows;
@@ -214,6 +230,49 @@ class GarnetNetwork : public Network
     std::vector<CreditLink *> m_creditlinks; // All credit links in the network
     std::vector<NetworkInterface *> m_nis;   // All NI's in Network
     int m_next_packet_id; // static vairable for packet id allocation
+    std::unique_ptr<AnalyticModel> m_analytic_model;
+
+    /*
+     * With num_threads set, routers woken up in a cycle are not evaluated
+     * from their own events. They are collected and evaluated together by
+     * m_evaluate_event, which runs after all default priority events of
+     * the cycle. The calling thread and num_threads - 1 worker threads
+     * each evaluate the routers of one partition, and the wakeups the
+     * routers request are replayed on the main thread afterwards in the
+     * order the routers were woken up. Results therefore are the same for
+     * any number of threads, but differ from the event-driven evaluation
+     * used when num_threads is 0. While RubyNetwork tracing is enabled,
+     * all the partitions are evaluated by the calling thread so that the
+     * trace stays readable.
+     *
+     * The workers are only started by the first evaluation and are
+     * stopped when the simulator drains, so they are never copied by a
+     * fork() or left running in a checkpoint. Draining waits for a
+     * pending evaluation, and the workers release the flits and credits
+     * they kept for reuse when they stop.
+     */
+    static constexpr Event::Priority EVALUATE_EV_PRI =
+        Event::Default_Pri + 1;
+
+    void evaluateRouters();
+    void evaluatePartition(int partition);
+    void workerMain(int partition, uint64_t epoch);
+    void startWorkers();
+    void stopWorkers();
+
+    uint32_t m_num_threads;
+    EventFunctionWrapper m_evaluate_event;
+    std::vector<Router *> m_active_routers;
+    std::vector<std::vector<Router *>> m_active_partitions;
+    std::vector<std::thread> m_workers;
+
+    // Protect the worker hand-off below
+    std::mutex m_worker_mutex;
+    std::condition_variable m_start_cv;
+    std::condition_variable m_done_cv;
+    uint64_t m_epoch;
+    int m_busy_workers;
+    bool m_terminate;
 };
 
 inline std::ostream&
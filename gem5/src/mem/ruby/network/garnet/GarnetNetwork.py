@@ -52,6 +52,25 @@ class GarnetNetwork(RubyNetwork):
     garnet_deadlock_threshold = Param.UInt32(
         50000, "network-level deadlock threshold"
     )
+    analytic_model = Param.Bool(
+        False,
+        "deliver packets after a latency computed from the route and the "
+        "link utilization instead of simulating the routers",
+    )
+    analytic_window = Param.Cycles(
+        1000, "cycles over which the analytic model measures link utilization"
+    )
+    analytic_max_utilization = Param.Float(
+        0.95, "upper bound of the link utilization in the analytic model"
+    )
+    num_threads = Param.UInt32(
+        0,
+        "host threads used to simulate the routers; with 0, each router is "
+        "evaluated from its own events, otherwise the routers are split "
+        "into blocks of consecutive ids (row bands on a mesh) and evaluated "
+        "in lock-step every cycle, with the same results for any number of "
+        "threads",
+    )
 
 
 class GarnetNetworkInterface(ClockedObject):
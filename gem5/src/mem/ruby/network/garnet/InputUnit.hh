@@ -116,9 +116,14 @@ class InputUnit : public Consumer
     inline flit*
     getTopFlit(int vc)
     {
+        assert(m_num_buffered_flits > 0);
+        m_num_buffered_flits--;
         return virtualChannels[vc].getTopFlit();
     }
 
+    // Number of flits buffered in all the input VCs
+    inline int get_num_buffered_flits() { return m_num_buffered_flits; }
+
     inline bool
     need_stage(int vc, flit_stage stage, Tick time)
     {
@@ -168,6 +173,7 @@ class InputUnit : public Consumer
 
     // Input Virtual channels
     std::vector<VirtualChannel> virtualChannels;
+    int m_num_buffered_flits;
 
     // Statistical variables
     std::vector<double> m_num_buffer_writes;
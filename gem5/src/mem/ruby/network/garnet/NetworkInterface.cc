@@ -32,12 +32,14 @@
 
 #include "mem/ruby/network/garnet/NetworkInterface.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
 #include "base/cast.hh"
 #include "debug/RubyNetwork.hh"
 #include "mem/ruby/network/MessageBuffer.hh"
+#include "mem/ruby/network/garnet/AnalyticModel.hh"
 #include "mem/ruby/network/garnet/Credit.hh"
 #include "mem/ruby/network/garnet/flitBuffer.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
@@ -59,6 +61,7 @@ NetworkInterface::NetworkInterface(const Params &p)
     vc_busy_counter(m_virtual_networks, 0)
 {
     m_stall_count.resize(m_virtual_networks);
+    m_analytic_stalled.resize(m_virtual_networks);
     niOutVcs.resize(0);
 }
 
@@ -223,6 +226,9 @@ NetworkInterface::wakeup()
     // message is enqueued to restrict ejection to one message per cycle.
     checkStallQueue();
 
+    if (m_net_ptr->isAnalytic())
+        deliverAnalyticPackets();
+
     /*********** Check the incoming flit link **********/
     DPRINTF(RubyNetwork, "Number of input ports: %d\n", inPorts.size());
     for (auto &iPort: inPorts) {
@@ -389,10 +395,13 @@ NetworkInterface::flitisizeMessage(MsgPtr msg_ptr, int vnet)
     for (int ctr = 0; ctr < dest_nodes.size(); ctr++) {
 
         // this will return a free output virtual channel
-        int vc = calculateVC(vnet);
-
-        if (vc == -1) {
-            return false ;
+        // The analytic model does not track virtual channels
+        int vc = -1;
+        if (!m_net_ptr->isAnalytic()) {
+            vc = calculateVC(vnet);
+            if (vc == -1) {
+                return false ;
+            }
         }
         MsgPtr new_msg_ptr = msg_ptr->clone();
         NodeID destID = dest_nodes[ctr];
@@ -436,6 +445,13 @@ NetworkInterface::flitisizeMessage(MsgPtr msg_ptr, int vnet)
 
         m_net_ptr->increment_injected_packets(vnet);
         m_net_ptr->update_traffic_distribution(route);
+
+        if (m_net_ptr->isAnalytic()) {
+            sendAnalyticPacket(new_msg_ptr, route, num_flits,
+                               curTick() - msg_ptr->getTime());
+            continue;
+        }
+
         int packet_id = m_net_ptr->getNextPacketID();
         for (int i = 0; i < num_flits; i++) {
             m_net_ptr->increment_injected_flits(vnet);
@@ -455,6 +471,103 @@ NetworkInterface::flitisizeMessage(MsgPtr msg_ptr, int vnet)
     return true ;
 }
 
+/*
+ * Send a packet to its destination NI through the analytic model. The
+ * packet does not enter the network: it is handed to the destination NI
+ * along with the time at which it arrives there.
+ */
+void
+NetworkInterface::sendAnalyticPacket(MsgPtr msg_ptr, const RouteInfo &route,
+                                     int num_flits, Tick src_delay)
+{
+    int vnet = route.vnet;
+    for (int i = 0; i < num_flits; i++) {
+        m_net_ptr->increment_injected_flits(vnet);
+    }
+
+    AnalyticPacket packet;
+    packet.msg_ptr = msg_ptr;
+    packet.vnet = vnet;
+    packet.num_flits = num_flits;
+    packet.enqueue_time = curTick();
+    packet.src_delay = src_delay;
+
+    Cycles latency = m_net_ptr->getAnalyticModel()->packetLatency(
+        route, m_id, num_flits, m_net_ptr->curCycle(), packet.hops);
+    Tick arrival = curTick() + m_net_ptr->cyclesToTicks(latency);
+
+    // Packets of an ordered vnet may not overtake each other
+    if (m_net_ptr->isVNetOrdered(vnet)) {
+        Tick &last = m_analytic_last_arrival[
+            ((uint64_t)route.dest_ni << 32) | vnet];
+        arrival = std::max(arrival, last);
+        last = arrival;
+    }
+
+    DPRINTF(RubyNetwork, "NI %d sending packet to NI %d vnet %d with "
+            "latency %d cycles\n", m_id, route.dest_ni, vnet, latency);
+    m_net_ptr->getNetworkInterface(route.dest_ni)->
+        receiveAnalyticPacket(packet, arrival);
+}
+
+void
+NetworkInterface::receiveAnalyticPacket(const AnalyticPacket &packet,
+                                        Tick arrival)
+{
+    m_analytic_packets.emplace(arrival, packet);
+    scheduleEventAbsolute(arrival);
+}
+
+// Move the packets that have arrived into the protocol buffers
+void
+NetworkInterface::deliverAnalyticPackets()
+{
+    Tick curTime = clockEdge();
+
+    for (int vnet = 0; vnet < m_analytic_stalled.size(); vnet++) {
+        if (m_analytic_stalled[vnet]) {
+            outNode_ptr[vnet]->unregisterDequeueCallback();
+            m_analytic_stalled[vnet] = false;
+        }
+    }
+
+    for (auto it = m_analytic_packets.begin();
+         it != m_analytic_packets.end() && it->first <= curTime; ) {
+        const AnalyticPacket &packet = it->second;
+        int vnet = packet.vnet;
+
+        if (!outNode_ptr[vnet]->areNSlotsAvailable(1, curTime)) {
+            // Try again once the protocol dequeues from this buffer
+            if (!m_analytic_stalled[vnet]) {
+                outNode_ptr[vnet]->registerDequeueCallback([this]() {
+                    dequeueCallback(); });
+                m_analytic_stalled[vnet] = true;
+            }
+            ++it;
+            continue;
+        }
+
+        outNode_ptr[vnet]->enqueue(packet.msg_ptr, curTime,
+                                   cyclesToTicks(Cycles(1)));
+
+        // Same accounting as incrementStats() for each of the flits
+        Tick network_delay = it->first - packet.enqueue_time -
+                             cyclesToTicks(Cycles(1));
+        Tick queueing_delay = packet.src_delay + (curTick() - it->first);
+        for (int i = 0; i < packet.num_flits; i++) {
+            m_net_ptr->increment_received_flits(vnet);
+            m_net_ptr->increment_flit_network_latency(network_delay, vnet);
+            m_net_ptr->increment_flit_queueing_latency(queueing_delay, vnet);
+        }
+        m_net_ptr->increment_received_packets(vnet);
+        m_net_ptr->increment_packet_network_latency(network_delay, vnet);
+        m_net_ptr->increment_packet_queueing_latency(queueing_delay, vnet);
+        m_net_ptr->increment_total_hops(packet.hops * packet.num_flits);
+
+        it = m_analytic_packets.erase(it);
+    }
+}
+
 // Looking for a free output vc
 int
 NetworkInterface::calculateVC(int vnet)
@@ -682,6 +795,11 @@ NetworkInterface::functionalRead(Packet *pkt, WriteMask &mask)
             read = true;
     }
 
+    for (auto &it : m_analytic_packets) {
+        if (it.second.msg_ptr->functionalRead(pkt, mask))
+            read = true;
+    }
+
     return read;
 }
 
@@ -696,6 +814,11 @@ NetworkInterface::functionalWrite(Packet *pkt)
     for (auto &oPort: outPorts) {
         num_functional_writes += oPort->outFlitQueue()->functionalWrite(pkt);
     }
+
+    for (auto &it : m_analytic_packets) {
+        if (it.second.msg_ptr->functionalWrite(pkt))
+            num_functional_writes++;
+    }
     return num_functional_writes;
 }
 
@@ -34,6 +34,8 @@
 #define __MEM_RUBY_NETWORK_GARNET_0_NETWORKINTERFACE_HH__
 
 #include <iostream>
+#include <map>
+#include <unordered_map>
 #include <vector>
 
 #include "mem/ruby/common/Consumer.hh"
@@ -84,6 +86,19 @@ class NetworkInterface : public ClockedObject, public Consumer
 
     void scheduleFlit(flit *t_flit);
 
+    // Packets sent through the analytic model (see AnalyticModel.hh)
+    struct AnalyticPacket
+    {
+        MsgPtr msg_ptr;
+        int vnet;
+        int num_flits;
+        int hops;
+        Tick enqueue_time;
+        Tick src_delay;
+    };
+
+    void receiveAnalyticPacket(const AnalyticPacket &packet, Tick arrival);
+
     int get_router_id(int vnet)
     {
         OutputPort *oPort = getOutportForVnet(vnet);
@@ -293,8 +308,19 @@ class NetworkInterface : public ClockedObject, public Consumer
     // When a vc stays busy for a long time, it indicates a deadlock
     std::vector<int> vc_busy_counter;
 
+    // Packets from the analytic model, by arrival time
+    std::multimap<Tick, AnalyticPacket> m_analytic_packets;
+    // Vnets whose protocol buffer had no space for an arrived packet
+    std::vector<bool> m_analytic_stalled;
+    // Last arrival time per destination and vnet, to keep ordered vnets
+    // in order
+    std::unordered_map<uint64_t, Tick> m_analytic_last_arrival;
+
     void checkStallQueue();
     bool flitisizeMessage(MsgPtr msg_ptr, int vnet);
+    void sendAnalyticPacket(MsgPtr msg_ptr, const RouteInfo &route,
+                            int num_flits, Tick src_delay);
+    void deliverAnalyticPackets();
     int calculateVC(int vnet);
 
 
@@ -141,8 +141,10 @@ OutputUnit::wakeup()
 
         delete t_credit;
 
+        // Wake up the whole router rather than just this unit, as the
+        // switch allocator relies on credits waking it up
         if (m_credit_link->isReady(curTick())) {
-            scheduleEvent(Cycles(1));
+            m_router->schedule_wakeup(Cycles(1));
         }
     }
 }
@@ -169,7 +171,7 @@ void
 OutputUnit::insert_flit(flit *t_flit)
 {
     outBuffer.insert(t_flit);
-    m_out_link->scheduleEventAbsolute(m_router->clockEdge(Cycles(1)));
+    m_router->schedule_consumer(m_out_link, m_router->clockEdge(Cycles(1)));
 }
 
 bool
@@ -53,7 +53,7 @@ Router::Router(const Params &p)
     m_virtual_networks(p.virt_nets), m_vc_per_vnet(p.vcs_per_vnet),
     m_num_vcs(m_virtual_networks * m_vc_per_vnet), m_bit_width(p.width),
     m_network_ptr(nullptr), routingUnit(this), switchAllocator(this),
-    crossbarSwitch(this)
+    crossbarSwitch(this), m_partition(0), m_evaluation_pending(false)
 {
     m_input_unit.clear();
     m_output_unit.clear();
@@ -70,6 +70,19 @@ Router::init()
 
 void
 Router::wakeup()
+{
+    // With lock-step evaluation, the network evaluates this router later
+    // in the cycle together with the other routers that woke up
+    if (m_network_ptr->isLockstep()) {
+        m_network_ptr->scheduleRouter(this);
+        return;
+    }
+
+    evaluate();
+}
+
+void
+Router::evaluate()
 {
     DPRINTF(RubyNetwork, "Router %d woke up\n", m_id);
     assert(clockEdge() == curTick());
@@ -174,7 +187,28 @@ void
 Router::schedule_wakeup(Cycles time)
 {
     // wake up after time cycles
-    scheduleEvent(time);
+    schedule_consumer(this, clockEdge(time));
+}
+
+// Wake up a consumer (this router, or one of its links) at the given time.
+// While evaluated in lock-step, possibly on a worker thread, the event queue
+// may not be touched, so the request is kept until commit_wakeups() is
+// called on the main thread.
+void
+Router::schedule_consumer(Consumer *consumer, Tick time)
+{
+    if (m_network_ptr->isLockstep())
+        m_pending_wakeups.emplace_back(consumer, time);
+    else
+        consumer->scheduleEventAbsolute(time);
+}
+
+void
+Router::commit_wakeups()
+{
+    for (auto &wakeup : m_pending_wakeups)
+        wakeup.first->scheduleEventAbsolute(wakeup.second);
+    m_pending_wakeups.clear();
 }
 
 std::string
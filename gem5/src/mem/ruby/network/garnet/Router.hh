@@ -34,6 +34,7 @@
 
 #include <iostream>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "mem/ruby/common/Consumer.hh"
@@ -72,6 +73,7 @@ class Router : public BasicRouter, public Consumer
     ~Router() = default;
 
     void wakeup();
+    void evaluate();
     void print(std::ostream& out) const {};
 
     void init();
@@ -119,6 +121,17 @@ class Router : public BasicRouter, public Consumer
     int route_compute(RouteInfo route, int inport, PortDirection direction);
     void grant_switch(int inport, flit *t_flit);
     void schedule_wakeup(Cycles time);
+    void schedule_consumer(Consumer *consumer, Tick time);
+
+    // For lock-step evaluation (see GarnetNetwork::scheduleRouter)
+    int get_partition() const { return m_partition; }
+    void set_partition(int partition) { m_partition = partition; }
+    bool is_evaluation_pending() const { return m_evaluation_pending; }
+    void set_evaluation_pending(bool pending)
+    {
+        m_evaluation_pending = pending;
+    }
+    void commit_wakeups();
 
     std::string getPortDirectionName(PortDirection direction);
     void printFaultVector(std::ostream& out);
@@ -155,6 +168,11 @@ class Router : public BasicRouter, public Consumer
     std::vector<std::shared_ptr<InputUnit>> m_input_unit;
     std::vector<std::shared_ptr<OutputUnit>> m_output_unit;
 
+    int m_partition;
+    bool m_evaluation_pending;
+    // Wakeups requested while being evaluated in lock-step
+    std::vector<std::pair<Consumer *, Tick>> m_pending_wakeups;
+
     // Statistical variables required for power computations
     statistics::Scalar m_buffer_reads;
     statistics::Scalar m_buffer_writes;
@@ -90,6 +90,18 @@ SwitchAllocator::init()
 void
 SwitchAllocator::wakeup()
 {
+    // Most wakeups of lightly loaded routers are only for credits or
+    // flits still in the link, with no flit buffered to allocate
+    bool has_flits = false;
+    for (int inport = 0; inport < m_num_inports; inport++) {
+        if (m_router->getInputUnit(inport)->get_num_buffered_flits() > 0) {
+            has_flits = true;
+            break;
+        }
+    }
+    if (!has_flits)
+        return;
+
     arbitrate_inports(); // First stage of allocation
     arbitrate_outports(); // Second stage of allocation
 
@@ -114,9 +126,11 @@ SwitchAllocator::arbitrate_inports()
     // Independent arbiter at each input port
     for (int inport = 0; inport < m_num_inports; inport++) {
         int invc = m_round_robin_invc[inport];
+        auto input_unit = m_router->getInputUnit(inport);
+        if (input_unit->get_num_buffered_flits() == 0)
+            continue;
 
         for (int invc_iter = 0; invc_iter < m_num_vcs; invc_iter++) {
-            auto input_unit = m_router->getInputUnit(inport);
 
             if (input_unit->need_stage(invc, SA_, curTick())) {
                 // This flit is in SA stage
@@ -352,7 +366,9 @@ SwitchAllocator::vc_allocate(int outport, int inport, int invc)
 }
 
 // Wakeup the router next cycle to perform SA again
-// if there are flits ready.
+// if there are flits ready that are allowed to be sent.
+// Flits waiting for a credit or a free output VC don't need a wakeup,
+// as the router is woken up by the credit link when the credit arrives.
 void
 SwitchAllocator::check_for_wakeup()
 {
@@ -363,8 +379,14 @@ SwitchAllocator::check_for_wakeup()
     }
 
     for (int i = 0; i < m_num_inports; i++) {
+        auto input_unit = m_router->getInputUnit(i);
+        if (input_unit->get_num_buffered_flits() == 0)
+            continue;
+
         for (int j = 0; j < m_num_vcs; j++) {
-            if (m_router->getInputUnit(i)->need_stage(j, SA_, nextCycle)) {
+            if (input_unit->need_stage(j, SA_, nextCycle) &&
+                send_allowed(i, j, input_unit->get_outport(j),
+                             input_unit->get_outvc(j))) {
                 m_router->schedule_wakeup(Cycles(1));
                 return;
             }
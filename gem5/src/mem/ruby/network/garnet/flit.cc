@@ -42,6 +42,85 @@ namespace ruby
 namespace garnet
 {
 
+namespace
+{
+
+struct FreeBlock
+{
+    FreeBlock *next;
+};
+
+// One free list per allocation size, i.e., one for flits and one for
+// credits. The lists are thread-local so that the routers evaluated by
+// the worker threads of a network don't contend on them. A block may be
+// freed by another thread than the one that allocated it, so the lists
+// are bounded for a thread that frees more blocks than it allocates
+// not to hoard them.
+struct FreeList
+{
+    std::size_t size = 0;
+    std::size_t length = 0;
+    FreeBlock *head = nullptr;
+};
+
+constexpr std::size_t maxFreeListLength = 4096;
+
+thread_local FreeList freeLists[2];
+
+FreeList *
+freeListFor(std::size_t size)
+{
+    for (auto &list : freeLists) {
+        if (list.size == 0)
+            list.size = size;
+        if (list.size == size)
+            return &list;
+    }
+    return nullptr;
+}
+
+} // anonymous namespace
+
+void *
+flit::operator new(std::size_t size)
+{
+    FreeList *list = freeListFor(size);
+    if (list && list->head) {
+        FreeBlock *block = list->head;
+        list->head = block->next;
+        list->length--;
+        return block;
+    }
+    return ::operator new(size);
+}
+
+void
+flit::operator delete(void *p, std::size_t size)
+{
+    FreeList *list = freeListFor(size);
+    if (!list || list->length == maxFreeListLength) {
+        ::operator delete(p);
+        return;
+    }
+    FreeBlock *block = static_cast<FreeBlock *>(p);
+    block->next = list->head;
+    list->head = block;
+    list->length++;
+}
+
+void
+flit::releaseFreeLists()
+{
+    for (auto &list : freeLists) {
+        while (list.head) {
+            FreeBlock *block = list.head;
+            list.head = block->next;
+            ::operator delete(block);
+        }
+        list.length = 0;
+    }
+}
+
 // Constructor for the flit
 flit::flit(int packet_id, int id, int  vc, int vnet, RouteInfo route, int size,
     MsgPtr msg_ptr, int MsgSize, uint32_t bWidth, Tick curTime)
@@ -32,6 +32,7 @@
 #define __MEM_RUBY_NETWORK_GARNET_0_FLIT_HH__
 
 #include <cassert>
+#include <cstddef>
 #include <iostream>
 
 #include "base/types.hh"
@@ -56,6 +57,14 @@ class flit
 
     virtual ~flit(){};
 
+    // Flits and credits are created at every hop, so freed ones are
+    // kept for reuse instead of going back to the heap (see flit.cc)
+    static void *operator new(std::size_t size);
+    static void operator delete(void *p, std::size_t size);
+    // Return the flits and credits kept by the calling thread to the
+    // heap, for threads that stop simulating the network
+    static void releaseFreeLists();
+
     int get_outport() {return m_outport; }
     int get_size() { return m_size; }
     Tick get_enqueue_time() { return m_enqueue_time; }
@@ -98,7 +98,8 @@ PerfectSwitch::updatePriorityGroups(int vnet, MessageBuffer* in_buf)
 {
     while (m_in_prio.size() <= vnet) {
         m_in_prio.emplace_back();
-        m_in_prio_groups.emplace_back();
+        m_in_prio_pos.emplace_back();
+        m_in_arbiters.emplace_back();
     }
 
     m_in_prio[vnet].push_back(in_buf);
@@ -107,14 +108,25 @@ PerfectSwitch::updatePriorityGroups(int vnet, MessageBuffer* in_buf)
         [](const MessageBuffer* i, const MessageBuffer* j)
         { return i->routingPriority() < j->routingPriority(); });
 
-    // reset groups
-    m_in_prio_groups[vnet].clear();
+    // reset groups and positions
+    std::vector<int> group_ends;
+    m_in_prio_pos[vnet].resize(m_in.size(), -1);
     int cur_prio = m_in_prio[vnet].front()->routingPriority();
-    m_in_prio_groups[vnet].emplace_back();
-    for (auto buf : m_in_prio[vnet]) {
-        if (buf->routingPriority() != cur_prio)
-            m_in_prio_groups[vnet].emplace_back();
-        m_in_prio_groups[vnet].back().push_back(buf);
+    for (int pos = 0; pos < m_in_prio[vnet].size(); ++pos) {
+        MessageBuffer *buf = m_in_prio[vnet][pos];
+        if (buf->routingPriority() != cur_prio) {
+            group_ends.push_back(pos);
+            cur_prio = buf->routingPriority();
+        }
+        m_in_prio_pos[vnet][buf->getIncomingLink()] = pos;
+    }
+    group_ends.push_back(m_in_prio[vnet].size());
+    m_in_arbiters[vnet].init(group_ends);
+
+    // messages may already be waiting in the buffers that moved
+    for (int pos = 0; pos < m_in_prio[vnet].size(); ++pos) {
+        if (!m_in_prio[vnet][pos]->isEmpty())
+            m_in_arbiters[vnet].setActive(pos);
     }
 }
 
@@ -155,31 +167,20 @@ PerfectSwitch::operateVnet(int vnet)
     if (m_pending_message_count[vnet] == 0)
         return;
 
-    for (auto &in : m_in_prio_groups[vnet]) {
-        // first check the port with the oldest message
-        unsigned start_in_port = 0;
-        Tick lowest_tick = MaxTick;
-        for (int i = 0; i < in.size(); ++i) {
-            MessageBuffer *buffer = in[i];
-            if (buffer) {
-                Tick ready_time = buffer->readyTime();
-                if (ready_time < lowest_tick){
-                    lowest_tick = ready_time;
-                    start_in_port = i;
-                }
-            }
-        }
-        DPRINTF(RubyNetwork, "vnet %d: %d pending msgs. "
-                            "Checking port %d first\n",
-                vnet, m_pending_message_count[vnet], start_in_port);
-        // check all ports starting with the one with the oldest message
-        for (int i = 0; i < in.size(); ++i) {
-            int in_port = (i + start_in_port) % in.size();
-            MessageBuffer *buffer = in[in_port];
-            if (buffer)
-                operateMessageBuffer(buffer, vnet);
-        }
-    }
+    DPRINTF(RubyNetwork, "vnet %d: %d pending msgs\n",
+            vnet, m_pending_message_count[vnet]);
+
+    // Only the ports that hold messages are visited, starting in each
+    // priority group with the one with the oldest message.
+    const std::vector<MessageBuffer*> &in = m_in_prio[vnet];
+    m_in_arbiters[vnet].arbitrate(
+        [&](int pos) { return in[pos]->readyTime(); },
+        [&](int pos) {
+            DPRINTF(RubyNetwork, "vnet %d: checking port %d\n",
+                    vnet, in[pos]->getIncomingLink());
+            operateMessageBuffer(in[pos], vnet);
+            return !in[pos]->isEmpty();
+        });
 }
 
 void
@@ -299,9 +300,12 @@ PerfectSwitch::wakeup()
 }
 
 void
-PerfectSwitch::storeEventInfo(int info)
+PerfectSwitch::storeEventInfo(MessageBuffer *buffer)
 {
-    m_pending_message_count[info]++;
+    int vnet = buffer->getVnet();
+    m_in_arbiters[vnet].setActive(
+        m_in_prio_pos[vnet][buffer->getIncomingLink()]);
+    m_pending_message_count[vnet]++;
 }
 
 void
@@ -54,6 +54,7 @@
 
 #include "mem/ruby/common/Consumer.hh"
 #include "mem/ruby/common/TypeDefines.hh"
+#include "mem/ruby/network/simple/PortArbiter.hh"
 
 namespace gem5
 {
@@ -87,7 +88,7 @@ class PerfectSwitch : public Consumer
     int getOutLinks() const { return m_out.size(); }
 
     void wakeup();
-    void storeEventInfo(int info);
+    void storeEventInfo(MessageBuffer *buffer);
 
     void clearStats();
     void collateStats();
@@ -117,8 +118,10 @@ class PerfectSwitch : public Consumer
 
     // input ports ordered by priority; indexed by vnet first
     std::vector<std::vector<MessageBuffer*> > m_in_prio;
-    // input ports grouped by priority; indexed by vnet,prio_lv
-    std::vector<std::vector<std::vector<MessageBuffer*>>> m_in_prio_groups;
+    // position of each input port in m_in_prio; indexed by vnet,in_port
+    std::vector<std::vector<int>> m_in_prio_pos;
+    // arbitration between the positions in m_in_prio; indexed by vnet
+    std::vector<PortArbiter> m_in_arbiters;
 
     void updatePriorityGroups(int vnet, MessageBuffer* buf);
 
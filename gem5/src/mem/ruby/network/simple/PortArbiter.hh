@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef __MEM_RUBY_NETWORK_SIMPLE_PORTARBITER_HH__
+#define __MEM_RUBY_NETWORK_SIMPLE_PORTARBITER_HH__
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * Arbitration between the input ports of a PerfectSwitch vnet.
+ *
+ * Ports are numbered by their position in priority order and split into
+ * groups of equal priority. A bitmap flags the ports that hold messages,
+ * so that arbitration only visits those. Groups are visited in order;
+ * within a group, visiting starts at the active port with the oldest
+ * message, the first one on ties, and wraps around to the start of the
+ * group.
+ */
+class PortArbiter
+{
+  public:
+    /** Sets up the ports, with group_ends holding the end of each group. */
+    void
+    init(const std::vector<int> &group_ends)
+    {
+        m_group_ends = group_ends;
+        int num_ports = m_group_ends.empty() ? 0 : m_group_ends.back();
+        m_active.assign((num_ports + 63) / 64, 0);
+    }
+
+    void setActive(int pos) { m_active[pos / 64] |= 1ULL << (pos % 64); }
+    void clearActive(int pos) { m_active[pos / 64] &= ~(1ULL << (pos % 64)); }
+
+    bool
+    isActive(int pos) const
+    {
+        return m_active[pos / 64] & (1ULL << (pos % 64));
+    }
+
+    /**
+     * Visits the active ports in arbitration order. ready_time(pos) gives
+     * the time of the oldest message of a port, and visit(pos) returns
+     * whether the port still holds messages. Ports that become active
+     * while visiting are visited if arbitration has not passed them yet.
+     */
+    template <typename ReadyTime, typename Visit>
+    void
+    arbitrate(ReadyTime ready_time, Visit visit)
+    {
+        int begin = 0;
+        for (int end : m_group_ends) {
+            // first check the port with the oldest message
+            int start = end;
+            Tick lowest_tick = MaxTick;
+            for (int pos = nextActive(begin, end); pos < end;
+                 pos = nextActive(pos + 1, end)) {
+                Tick tick = ready_time(pos);
+                if (tick < lowest_tick) {
+                    lowest_tick = tick;
+                    start = pos;
+                }
+            }
+
+            if (start != end) {
+                visitRange(start, end, visit);
+                visitRange(begin, start, visit);
+            }
+            begin = end;
+        }
+    }
+
+  private:
+    /** The first active port in [pos, end), or end if there is none. */
+    int
+    nextActive(int pos, int end) const
+    {
+        while (pos < end) {
+            uint64_t word = m_active[pos / 64] >> (pos % 64);
+            if (word)
+                return std::min(pos + findLsbSet(word), end);
+            pos = (pos / 64 + 1) * 64;
+        }
+        return end;
+    }
+
+    template <typename Visit>
+    void
+    visitRange(int begin, int end, Visit &visit)
+    {
+        for (int pos = nextActive(begin, end); pos < end;
+             pos = nextActive(pos + 1, end)) {
+            if (!visit(pos))
+                clearActive(pos);
+        }
+    }
+
+    std::vector<int> m_group_ends;
+    std::vector<uint64_t> m_active;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_NETWORK_SIMPLE_PORTARBITER_HH__
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "mem/ruby/network/simple/PortArbiter.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+namespace
+{
+
+// The order in which PerfectSwitch used to scan its input ports: in each
+// group, every port starting from the one with the oldest message (empty
+// ports read as MaxTick), wrapping around. Only the ports that hold
+// messages are returned, as visiting an empty port does nothing.
+std::vector<int>
+scanOrder(const std::vector<int> &group_ends,
+          const std::vector<Tick> &ready_times)
+{
+    std::vector<int> order;
+    int begin = 0;
+    for (int end : group_ends) {
+        int size = end - begin;
+        int start_in_port = 0;
+        Tick lowest_tick = MaxTick;
+        for (int i = 0; i < size; ++i) {
+            if (ready_times[begin + i] < lowest_tick) {
+                lowest_tick = ready_times[begin + i];
+                start_in_port = i;
+            }
+        }
+        for (int i = 0; i < size; ++i) {
+            int pos = begin + (i + start_in_port) % size;
+            if (ready_times[pos] != MaxTick)
+                order.push_back(pos);
+        }
+        begin = end;
+    }
+    return order;
+}
+
+std::vector<int>
+arbitrateOrder(PortArbiter &arbiter, const std::vector<Tick> &ready_times)
+{
+    std::vector<int> order;
+    arbiter.arbitrate(
+        [&](int pos) { return ready_times[pos]; },
+        [&](int pos) { order.push_back(pos); return false; });
+    return order;
+}
+
+} // anonymous namespace
+
+TEST(PortArbiterTest, MatchesScanOrder)
+{
+    // Groups that straddle the 64-bit words of the bitmap
+    const std::vector<int> group_ends = {3, 70, 130, 131, 200};
+    const int num_ports = group_ends.back();
+    std::mt19937 rng(1);
+
+    for (int iter = 0; iter < 1000; iter++) {
+        PortArbiter arbiter;
+        arbiter.init(group_ends);
+
+        // Few distinct ready times, so that ties are common
+        std::vector<Tick> ready_times(num_ports, MaxTick);
+        int active_pct = rng() % 100;
+        for (int pos = 0; pos < num_ports; pos++) {
+            if (int(rng() % 100) < active_pct) {
+                ready_times[pos] = rng() % 8;
+                arbiter.setActive(pos);
+            }
+        }
+
+        EXPECT_EQ(scanOrder(group_ends, ready_times),
+                  arbitrateOrder(arbiter, ready_times));
+
+        // Drained ports are no longer active
+        for (int pos = 0; pos < num_ports; pos++)
+            EXPECT_FALSE(arbiter.isActive(pos));
+    }
+}
+
+TEST(PortArbiterTest, WrapAround)
+{
+    PortArbiter arbiter;
+    arbiter.init({100, 150});
+    std::vector<Tick> ready_times(150, MaxTick);
+
+    for (int pos : {2, 63, 64, 80, 99, 100, 149}) {
+        ready_times[pos] = 10;
+        arbiter.setActive(pos);
+    }
+    // The oldest message of each group is at 80 and 149
+    ready_times[80] = 5;
+    ready_times[149] = 5;
+
+    EXPECT_EQ((std::vector<int>{80, 99, 2, 63, 64, 149, 100}),
+              arbitrateOrder(arbiter, ready_times));
+}
+
+TEST(PortArbiterTest, PortsStayActiveUntilDrained)
+{
+    PortArbiter arbiter;
+    arbiter.init({130});
+    arbiter.setActive(1);
+    arbiter.setActive(65);
+    arbiter.setActive(129);
+
+    // Port 65 still holds messages after its visit
+    std::vector<int> order;
+    arbiter.arbitrate([](int pos) { return Tick(pos); },
+        [&](int pos) { order.push_back(pos); return pos == 65; });
+    EXPECT_EQ((std::vector<int>{1, 65, 129}), order);
+    EXPECT_FALSE(arbiter.isActive(1));
+    EXPECT_TRUE(arbiter.isActive(65));
+    EXPECT_FALSE(arbiter.isActive(129));
+
+    order.clear();
+    arbiter.arbitrate([](int pos) { return Tick(pos); },
+        [&](int pos) { order.push_back(pos); return false; });
+    EXPECT_EQ((std::vector<int>{65}), order);
+}
+
+TEST(PortArbiterTest, ActivatedWhileVisiting)
+{
+    // Like the old scan, a port that gets a message is visited if
+    // arbitration has not passed it yet.
+    PortArbiter arbiter;
+    arbiter.init({128});
+    arbiter.setActive(64);
+
+    std::vector<int> order;
+    arbiter.arbitrate([](int pos) { return Tick(0); },
+        [&](int pos) {
+            order.push_back(pos);
+            if (pos == 64) {
+                arbiter.setActive(10);
+                arbiter.setActive(100);
+            }
+            return false;
+        });
+    EXPECT_EQ((std::vector<int>{64, 100, 10}), order);
+}
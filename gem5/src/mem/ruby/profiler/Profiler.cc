@@ -50,13 +50,17 @@
 #include <algorithm>
 #include <fstream>
 
+#include "base/cprintf.hh"
+#include "base/output.hh"
 #include "base/stl_helpers.hh"
 #include "base/str.hh"
 #include "config/build_gpu.hh"
 #include "mem/ruby/network/Network.hh"
 #include "mem/ruby/profiler/AddressProfiler.hh"
+#include "mem/ruby/profiler/SharingProfiler.hh"
 #include "mem/ruby/protocol/MachineType.hh"
 #include "mem/ruby/protocol/RubyRequest.hh"
+#include "sim/cur_tick.hh"
 
 /**
  * the profiler uses GPUCoalescer code even
@@ -101,6 +105,12 @@ Profiler::Profiler(const RubySystemParams &p, RubySystem *rs)
         m_inst_profiler_ptr->setHotLines(m_hot_lines);
         m_inst_profiler_ptr->setAllInstructions(m_all_instructions);
     }
+
+    if (p.sharing_profiler_sample_rate > 0) {
+        m_sharing_profiler_ptr = std::make_unique<SharingProfiler>(
+            p.sharing_profiler_sample_rate, p.sharing_profiler_entries,
+            p.sharing_profiler_top_lines, rs->getBlockSizeBits());
+    }
 }
 
 Profiler::~Profiler()
@@ -378,6 +388,14 @@ Profiler::collateStats()
         m_inst_profiler_ptr->collateStats();
     }
 
+    if (m_sharing_profiler_ptr) {
+        std::ostream *os = simout.findOrCreate(
+            m_ruby_system->name() + ".hot_lines.txt")->stream();
+        ccprintf(*os, "---------- Tick %d ----------\n", curTick());
+        m_sharing_profiler_ptr->print(*os);
+        os->flush();
+    }
+
     for (uint32_t i = 0; i < MachineType_NUM; i++) {
         for (std::map<uint32_t, AbstractController*>::iterator it =
                   m_ruby_system->m_abstract_controls[i].begin();
@@ -568,6 +586,14 @@ Profiler::collateStats()
     }
 }
 
+void
+Profiler::resetStats()
+{
+    if (m_sharing_profiler_ptr) {
+        m_sharing_profiler_ptr->clearStats();
+    }
+}
+
 void
 Profiler::addAddressTraceSample(const RubyRequest& msg, NodeID id)
 {
@@ -67,6 +67,7 @@ namespace ruby
 
 class RubyRequest;
 class AddressProfiler;
+class SharingProfiler;
 
 class Profiler
 {
@@ -79,9 +80,15 @@ class Profiler
     void wakeup();
     void regStats();
     void collateStats();
+    void resetStats();
 
     AddressProfiler* getAddressProfiler() { return m_address_profiler_ptr; }
     AddressProfiler* getInstructionProfiler() { return m_inst_profiler_ptr; }
+    SharingProfiler*
+    getSharingProfiler()
+    {
+        return m_sharing_profiler_ptr.get();
+    }
 
     void addAddressTraceSample(const RubyRequest& msg, NodeID id);
 
@@ -96,6 +103,7 @@ class Profiler
 
     AddressProfiler* m_address_profiler_ptr;
     AddressProfiler* m_inst_profiler_ptr;
+    std::unique_ptr<SharingProfiler> m_sharing_profiler_ptr;
 
     struct ProfilerStats : public statistics::Group
     {
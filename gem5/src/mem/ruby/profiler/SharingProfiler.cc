@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/ruby/profiler/SharingProfiler.hh"
+
+#include <algorithm>
+
+#include "base/bitfield.hh"
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+SharingProfiler::SharingProfiler(uint32_t sample_rate, uint32_t num_entries,
+                                 uint32_t top_lines,
+                                 unsigned block_size_bits)
+    : m_sample_rate(sample_rate),
+      m_sample_threshold(sample_rate ? UINT64_MAX / sample_rate : 0),
+      m_block_size_bits(block_size_bits),
+      m_top_lines(top_lines),
+      m_num_sets(std::max(num_entries / assoc, 1U)),
+      m_entries(m_num_sets * assoc), m_replacements(0)
+{
+    fatal_if(m_sample_rate == 0, "Sharing profiler sample rate must be > 0");
+}
+
+SharingProfiler::Entry *
+SharingProfiler::setOf(Addr line)
+{
+    return &m_entries[((hash(line) >> 16) % m_num_sets) * assoc];
+}
+
+SharingProfiler::Entry *
+SharingProfiler::find(Addr line)
+{
+    Entry *set = setOf(line);
+    for (unsigned way = 0; way < assoc; way++) {
+        if (set[way].valid && set[way].line == line)
+            return &set[way];
+    }
+    return nullptr;
+}
+
+SharingProfiler::Entry &
+SharingProfiler::lookup(Addr line)
+{
+    Entry *set = setOf(line);
+    Entry *victim = &set[0];
+
+    for (unsigned way = 0; way < assoc; way++) {
+        Entry &entry = set[way];
+        if (!entry.valid) {
+            if (victim->valid)
+                victim = &entry;
+        } else if (entry.line == line) {
+            return entry;
+        } else if (victim->valid && entry.accesses < victim->accesses) {
+            victim = &entry;
+        }
+    }
+
+    // The new line inherits the access count of the line it replaces, so
+    // that a stream of cold lines cannot displace a hot one.
+    uint64_t accesses = 0;
+    if (victim->valid) {
+        accesses = victim->accesses;
+        m_replacements++;
+    }
+
+    *victim = Entry();
+    victim->line = line;
+    victim->valid = true;
+    victim->accesses = accesses;
+    return *victim;
+}
+
+void
+SharingProfiler::profileAccess(Addr line, int requestor, bool is_write)
+{
+    Entry &entry = lookup(line);
+    uint64_t requestor_bit = 1ULL << (requestor % 64);
+
+    entry.accesses++;
+    if (is_write) {
+        // A write leaves the writer as the only copy, so every other
+        // sharer would have been invalidated.
+        unsigned invalidated = popCount(entry.sharers & ~requestor_bit);
+        entry.writes++;
+        entry.invalidations += invalidated;
+        entry.maxInvalidations = std::max(entry.maxInvalidations,
+                                          invalidated);
+        if (entry.lastWriter != -1 && entry.lastWriter != requestor)
+            entry.transfers++;
+        entry.lastWriter = requestor;
+        entry.sharers = requestor_bit;
+    } else {
+        entry.sharers |= requestor_bit;
+        entry.maxSharers = std::max(entry.maxSharers,
+                                    (unsigned)popCount(entry.sharers));
+    }
+}
+
+void
+SharingProfiler::profileEviction(Addr line, int requestor)
+{
+    // Evictions of lines that were never accessed while sampled are
+    // not worth a table entry.
+    Entry *entry = find(line);
+    if (!entry)
+        return;
+
+    entry->evictions++;
+    entry->sharers &= ~(1ULL << (requestor % 64));
+}
+
+void
+SharingProfiler::print(std::ostream& out) const
+{
+    std::vector<const Entry *> lines;
+    for (const auto &entry : m_entries) {
+        if (entry.valid)
+            lines.push_back(&entry);
+    }
+
+    size_t top = std::min<size_t>(m_top_lines, lines.size());
+    std::partial_sort(lines.begin(), lines.begin() + top, lines.end(),
+        [](const Entry *a, const Entry *b) {
+            if (a->coherenceEvents() != b->coherenceEvents())
+                return a->coherenceEvents() > b->coherenceEvents();
+            return a->accesses > b->accesses;
+        });
+
+    ccprintf(out, "Hot lines (1 in %d lines sampled, %d tracked, "
+             "%d replaced):\n", m_sample_rate, lines.size(), m_replacements);
+    ccprintf(out, "%18s %12s %12s %8s %14s %10s %12s %12s\n",
+             "line", "accesses", "writes", "sharers", "invalidations",
+             "max_storm", "transfers", "evictions");
+    for (size_t i = 0; i < top; i++) {
+        const Entry &entry = *lines[i];
+        ccprintf(out, "%#18x %12d %12d %8d %14d %10d %12d %12d\n",
+                 entry.line, entry.accesses, entry.writes, entry.maxSharers,
+                 entry.invalidations, entry.maxInvalidations,
+                 entry.transfers, entry.evictions);
+    }
+}
+
+void
+SharingProfiler::clearStats()
+{
+    std::fill(m_entries.begin(), m_entries.end(), Entry());
+    m_replacements = 0;
+}
+
+} // namespace ruby
+} // namespace gem5
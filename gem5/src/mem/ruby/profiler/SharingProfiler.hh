@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_PROFILER_SHARINGPROFILER_HH__
+#define __MEM_RUBY_PROFILER_SHARINGPROFILER_HH__
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "mem/ruby/common/Address.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * Sampling profiler for sharing and contention on individual cache lines.
+ *
+ * Only 1 in N lines, picked by hashing the line address, are profiled, so
+ * every access to a sampled line is seen while the common case costs a
+ * single multiply and compare. Sampled lines live in a small
+ * set-associative table; when a set is full, the line with the fewest
+ * accesses makes room for the new one, which inherits its count as in the
+ * space-saving sketch, so hot lines are not pushed out by cold ones.
+ *
+ * For each line the profiler tracks, per sequencer:
+ * - the sharers that read it since its last write;
+ * - the copies a write would invalidate (invalidation storms);
+ * - ownership moving between writers (ping-ponging);
+ * - the evictions reported by the protocol.
+ * Sharers are kept as a 64-bit mask of the sequencer ids, so they are
+ * approximate beyond 64 sequencers. A sharer is only dropped when its
+ * sequencer reports an eviction through Sequencer::evictionCallback(),
+ * which protocols only call for controllers with send_evictions set.
+ * Otherwise silent evictions are not seen, and the sharer and
+ * invalidation counts are overestimates.
+ */
+class SharingProfiler
+{
+  public:
+    SharingProfiler(uint32_t sample_rate, uint32_t num_entries,
+                    uint32_t top_lines, unsigned block_size_bits);
+
+    bool
+    isSampled(Addr line) const
+    {
+        return hash(line) <= m_sample_threshold;
+    }
+
+    void profileAccess(Addr line, int requestor, bool is_write);
+    void profileEviction(Addr line, int requestor);
+
+    /** Print the lines with the most coherence activity. */
+    void print(std::ostream& out) const;
+    void clearStats();
+
+  private:
+    struct Entry
+    {
+        Addr line = 0;
+        bool valid = false;
+        uint64_t accesses = 0;
+        uint64_t writes = 0;
+        uint64_t sharers = 0;
+        unsigned maxSharers = 0;
+        uint64_t invalidations = 0;
+        unsigned maxInvalidations = 0;
+        uint64_t transfers = 0;
+        uint64_t evictions = 0;
+        int lastWriter = -1;
+
+        uint64_t
+        coherenceEvents() const
+        {
+            return invalidations + transfers + evictions;
+        }
+    };
+
+    uint64_t
+    hash(Addr line) const
+    {
+        return (line >> m_block_size_bits) * 0x9e3779b97f4a7c15ULL;
+    }
+
+    /** The entry of a line, allocating one if it is not tracked. */
+    Entry &lookup(Addr line);
+    /** The entry of a line, or nullptr if it is not tracked. */
+    Entry *find(Addr line);
+    /** The first way of the set a line maps to. */
+    Entry *setOf(Addr line);
+
+    static const unsigned assoc = 8;
+
+    const uint32_t m_sample_rate;
+    // 1 in m_sample_rate hashes are at most this
+    const uint64_t m_sample_threshold;
+    const unsigned m_block_size_bits;
+    const uint32_t m_top_lines;
+    const uint32_t m_num_sets;
+    std::vector<Entry> m_entries;
+
+    uint64_t m_replacements;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_PROFILER_SHARINGPROFILER_HH__
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "mem/ruby/profiler/SharingProfiler.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+namespace
+{
+
+const unsigned blockSizeBits = 6;
+
+// Parses the report of a profiler into the counters of each line, in the
+// order of the columns: accesses, writes, sharers, invalidations,
+// max_storm, transfers, evictions.
+std::map<Addr, std::vector<uint64_t>>
+report(const SharingProfiler &profiler)
+{
+    std::ostringstream out;
+    profiler.print(out);
+
+    std::istringstream in(out.str());
+    std::string row;
+    std::getline(in, row);
+    std::getline(in, row);
+
+    std::map<Addr, std::vector<uint64_t>> lines;
+    while (std::getline(in, row)) {
+        std::istringstream fields(row);
+        Addr line;
+        fields >> std::hex >> line >> std::dec;
+        std::vector<uint64_t> &counters = lines[line];
+        uint64_t counter;
+        while (fields >> counter)
+            counters.push_back(counter);
+    }
+    return lines;
+}
+
+} // anonymous namespace
+
+TEST(SharingProfilerTest, CountsSharingAndTransfers)
+{
+    SharingProfiler profiler(1, 64, 10, blockSizeBits);
+
+    profiler.profileAccess(0x40, 0, false);
+    profiler.profileAccess(0x40, 1, false);
+    // Invalidates sequencers 0 and 1
+    profiler.profileAccess(0x40, 2, true);
+    // Invalidates sequencer 2 and takes ownership from it
+    profiler.profileAccess(0x40, 0, true);
+
+    auto lines = report(profiler);
+    ASSERT_EQ(1u, lines.size());
+    EXPECT_EQ((std::vector<uint64_t>{4, 2, 2, 3, 2, 1, 0}), lines[0x40]);
+}
+
+TEST(SharingProfilerTest, EvictionDropsSharer)
+{
+    SharingProfiler profiler(1, 64, 10, blockSizeBits);
+
+    profiler.profileAccess(0x80, 0, false);
+    profiler.profileAccess(0x80, 1, false);
+    profiler.profileEviction(0x80, 1);
+    profiler.profileAccess(0x80, 2, true);
+
+    auto lines = report(profiler);
+    ASSERT_EQ(1u, lines.size());
+    EXPECT_EQ((std::vector<uint64_t>{3, 1, 2, 1, 1, 0, 1}), lines[0x80]);
+}
+
+TEST(SharingProfilerTest, EvictionOfUntrackedLine)
+{
+    SharingProfiler profiler(1, 64, 10, blockSizeBits);
+
+    profiler.profileEviction(0x80, 1);
+    EXPECT_TRUE(report(profiler).empty());
+}
+
+TEST(SharingProfilerTest, ReplacementInheritsAccesses)
+{
+    // A single set of 8 lines, where line i is read i + 1 times
+    SharingProfiler profiler(1, 8, 10, blockSizeBits);
+    for (Addr i = 0; i < 8; i++) {
+        for (Addr n = 0; n <= i; n++)
+            profiler.profileAccess(i << blockSizeBits, 0, false);
+    }
+
+    // Replaces line 0, the one with the fewest accesses, and inherits its
+    // single access.
+    profiler.profileAccess(8 << blockSizeBits, 0, false);
+
+    auto lines = report(profiler);
+    ASSERT_EQ(8u, lines.size());
+    EXPECT_EQ(0u, lines.count(0));
+    ASSERT_EQ(1u, lines.count(8 << blockSizeBits));
+    EXPECT_EQ(2u, lines[8 << blockSizeBits][0]);
+    EXPECT_EQ(8u, lines[7 << blockSizeBits][0]);
+
+    // Line 8 now ties with line 1 for the fewest accesses and, being in
+    // the first way, is replaced next, while the hot lines stay put.
+    profiler.profileAccess(9 << blockSizeBits, 0, false);
+    lines = report(profiler);
+    EXPECT_EQ(0u, lines.count(8 << blockSizeBits));
+    EXPECT_EQ(3u, lines[9 << blockSizeBits][0]);
+    EXPECT_EQ(1u, lines.count(1 << blockSizeBits));
+    EXPECT_EQ(1u, lines.count(7 << blockSizeBits));
+}
+
+TEST(SharingProfilerTest, ClearStats)
+{
+    SharingProfiler profiler(1, 64, 10, blockSizeBits);
+    profiler.profileAccess(0x40, 0, true);
+    profiler.clearStats();
+
+    EXPECT_TRUE(report(profiler).empty());
+}
+
+TEST(SharingProfilerTest, Sampling)
+{
+    SharingProfiler all(1, 64, 10, blockSizeBits);
+    SharingProfiler some(4, 64, 10, blockSizeBits);
+
+    unsigned sampled = 0;
+    for (Addr i = 0; i < 4096; i++) {
+        EXPECT_TRUE(all.isSampled(i << blockSizeBits));
+        if (some.isSampled(i << blockSizeBits))
+            sampled++;
+    }
+    EXPECT_GT(sampled, 4096u * 3 / 16);
+    EXPECT_LT(sampled, 4096u * 5 / 16);
+}
@@ -117,6 +117,20 @@ class AbstractController : public ClockedObject, public Consumer
     virtual void regStats();
 
     virtual void recordCacheTrace(int cntrl, CacheRecorder* tr) = 0;
+
+    //! Installs a block restored from a cache trace directly into the
+    //! controller's state, without generating any protocol traffic. The
+    //! controller that recorded the block is asked first, with itself as
+    //! the holder; if it accepts, every other controller is called with
+    //! the same holder so it can update its directory state. Protocols
+    //! opt in by defining functionalWarmup in SLICC; by default the block
+    //! is declined and gets replayed through the sequencer instead.
+    virtual bool functionalWarmup(const Addr &addr,
+                                  const RubyRequestType &type,
+                                  const DataBlock &data,
+                                  const MachineID &holder)
+    { return false; }
+
     virtual Sequencer* getCPUSequencer() const = 0;
     virtual DMASequencer* getDMASequencer() const = 0;
     virtual GPUCoalescer* getGPUCoalescer() const = 0;
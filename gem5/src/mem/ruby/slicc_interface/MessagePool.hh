@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_SLICC_INTERFACE_MESSAGEPOOL_HH__
+#define __MEM_RUBY_SLICC_INTERFACE_MESSAGEPOOL_HH__
+
+#include <cstddef>
+#include <memory>
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * An allocator keeping freed memory in a per-type free list, used with
+ * std::allocate_shared to create messages. After the first few messages of
+ * a type, sending one reuses the memory of a dequeued one (its
+ * shared_ptr control block and the message itself, which allocate_shared
+ * puts in a single block) instead of calling malloc.
+ *
+ * The free lists are thread-local, so they need no locking. A block freed
+ * on another thread than it was allocated on just moves to that thread's
+ * list. The free lists are never trimmed, so they hold at most as many
+ * blocks as there were messages of a type alive at once.
+ */
+template <class T>
+class MessagePoolAllocator
+{
+  public:
+    typedef T value_type;
+
+    MessagePoolAllocator() = default;
+
+    template <class U>
+    MessagePoolAllocator(const MessagePoolAllocator<U> &) {}
+
+    T *
+    allocate(std::size_t n)
+    {
+        Node *&head = freeList();
+        if (n == 1 && head) {
+            Node *node = head;
+            head = node->next;
+            return reinterpret_cast<T *>(node);
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void
+    deallocate(T *p, std::size_t n)
+    {
+        if (n == 1 && sizeof(T) >= sizeof(Node)) {
+            Node *&head = freeList();
+            Node *node = reinterpret_cast<Node *>(p);
+            node->next = head;
+            head = node;
+        } else {
+            std::allocator<T>().deallocate(p, n);
+        }
+    }
+
+  private:
+    struct Node
+    {
+        Node *next;
+    };
+
+    static Node *&
+    freeList()
+    {
+        // A plain pointer rather than an object with a destructor, so
+        // messages freed during exit never see a destroyed free list.
+        static thread_local Node *head = nullptr;
+        return head;
+    }
+};
+
+template <class T, class U>
+bool
+operator==(const MessagePoolAllocator<T> &, const MessagePoolAllocator<U> &)
+{
+    return true;
+}
+
+template <class T, class U>
+bool
+operator!=(const MessagePoolAllocator<T> &, const MessagePoolAllocator<U> &)
+{
+    return false;
+}
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_SLICC_INTERFACE_MESSAGEPOOL_HH__
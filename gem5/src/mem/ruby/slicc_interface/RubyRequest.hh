@@ -219,8 +219,17 @@ class RubyRequest : public Message
     }
 
     RubyRequest(Tick curTime) : Message(curTime) {}
-    MsgPtr clone() const
-    { return std::shared_ptr<Message>(new RubyRequest(*this)); }
+    MsgPtr clone() const { return create(*this); }
+
+    /** Allocate a RubyRequest from the free list of RubyRequests. */
+    template <typename... Args>
+    static std::shared_ptr<RubyRequest>
+    create(Args&&... args)
+    {
+        return std::allocate_shared<RubyRequest>(
+            MessagePoolAllocator<RubyRequest>(),
+            std::forward<Args>(args)...);
+    }
 
     Addr getLineAddress() const { return m_LineAddress; }
     Addr getPhysicalAddress() const { return m_PhysicalAddress; }
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_STRUCTURES_ADDRESSINDEX_HH__
+#define __MEM_RUBY_STRUCTURES_ADDRESSINDEX_HH__
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "mem/ruby/common/Address.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * A fixed-capacity map from addresses to non-negative integers (e.g., the
+ * way of a cache block or the slot of a TBE), replacing std::unordered_map
+ * in the lookups done by every transition.
+ *
+ * It is an open-addressing hash table with linear probing, sized to at
+ * least twice the capacity it is constructed with, so it never rehashes
+ * and probe sequences stay short. Erasing shifts the following entries
+ * back instead of leaving tombstones.
+ */
+class AddressIndex
+{
+  public:
+    AddressIndex(int capacity = 0)
+    {
+        init(capacity);
+    }
+
+    /** Clear the index and size it to hold up to capacity addresses. */
+    void
+    init(int capacity)
+    {
+        m_capacity = capacity;
+        m_size = 0;
+        int num_buckets = 1 << ceilLog2(std::max(2, 2 * capacity));
+        m_mask = num_buckets - 1;
+        m_shift = 64 - floorLog2(num_buckets);
+        m_buckets.assign(num_buckets, Bucket{0, -1});
+    }
+
+    /** Returns the value of address, or -1 if it is not present. */
+    int
+    lookup(Addr address) const
+    {
+        for (unsigned i = home(address); ; i = (i + 1) & m_mask) {
+            const Bucket &bucket = m_buckets[i];
+            if (bucket.value < 0 || bucket.address == address)
+                return bucket.value;
+        }
+    }
+
+    /** Set the value of address, adding it if it is not present. */
+    void
+    insert(Addr address, int value)
+    {
+        assert(value >= 0);
+        unsigned i = home(address);
+        while (m_buckets[i].value >= 0 && m_buckets[i].address != address)
+            i = (i + 1) & m_mask;
+
+        if (m_buckets[i].value < 0) {
+            assert(m_size < m_capacity);
+            m_size++;
+        }
+        m_buckets[i] = Bucket{address, value};
+    }
+
+    /** Remove address, if it is present. */
+    void
+    erase(Addr address)
+    {
+        unsigned i = home(address);
+        while (m_buckets[i].address != address) {
+            if (m_buckets[i].value < 0)
+                return;
+            i = (i + 1) & m_mask;
+        }
+        if (m_buckets[i].value < 0)
+            return;
+        m_size--;
+
+        // Move back entries whose home bucket isn't between the hole and
+        // their current bucket, so lookups never stop early at the hole.
+        for (unsigned j = (i + 1) & m_mask; m_buckets[j].value >= 0;
+             j = (j + 1) & m_mask) {
+            unsigned k = home(m_buckets[j].address);
+            if (((j - k) & m_mask) >= ((j - i) & m_mask)) {
+                m_buckets[i] = m_buckets[j];
+                i = j;
+            }
+        }
+        m_buckets[i].value = -1;
+    }
+
+    int size() const { return m_size; }
+    int capacity() const { return m_capacity; }
+
+    /** Call f(address, value) for every address in the index. */
+    template <typename F>
+    void
+    forEach(F f) const
+    {
+        for (const Bucket &bucket : m_buckets) {
+            if (bucket.value >= 0)
+                f(bucket.address, bucket.value);
+        }
+    }
+
+  private:
+    struct Bucket
+    {
+        Addr address;
+        int value;
+    };
+
+    unsigned
+    home(Addr address) const
+    {
+        // Fibonacci hashing, so the zero low bits of line addresses don't
+        // leave most buckets unused.
+        return (address * 0x9e3779b97f4a7c15ULL) >> m_shift;
+    }
+
+    std::vector<Bucket> m_buckets;
+    unsigned m_mask;
+    int m_shift;
+    int m_capacity;
+    int m_size;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_STRUCTURES_ADDRESSINDEX_HH__
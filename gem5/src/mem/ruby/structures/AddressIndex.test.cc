@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <unordered_map>
+
+#include "mem/ruby/structures/AddressIndex.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+TEST(AddressIndexTest, InsertLookupErase)
+{
+    AddressIndex index(4);
+    EXPECT_EQ(-1, index.lookup(0x40));
+
+    index.insert(0x40, 1);
+    index.insert(0x80, 2);
+    EXPECT_EQ(1, index.lookup(0x40));
+    EXPECT_EQ(2, index.lookup(0x80));
+    EXPECT_EQ(2, index.size());
+
+    // Inserting a present address updates its value.
+    index.insert(0x40, 3);
+    EXPECT_EQ(3, index.lookup(0x40));
+    EXPECT_EQ(2, index.size());
+
+    index.erase(0x40);
+    EXPECT_EQ(-1, index.lookup(0x40));
+    EXPECT_EQ(2, index.lookup(0x80));
+    EXPECT_EQ(1, index.size());
+
+    // Erasing an absent address does nothing.
+    index.erase(0x40);
+    EXPECT_EQ(1, index.size());
+}
+
+TEST(AddressIndexTest, Full)
+{
+    AddressIndex index(16);
+    for (int i = 0; i < 16; i++)
+        index.insert(i * 0x1000, i);
+    for (int i = 0; i < 16; i++)
+        EXPECT_EQ(i, index.lookup(i * 0x1000));
+    EXPECT_EQ(-1, index.lookup(16 * 0x1000));
+
+    int count = 0;
+    index.forEach([&](Addr address, int value) {
+        EXPECT_EQ(value * 0x1000u, address);
+        count++;
+    });
+    EXPECT_EQ(16, count);
+}
+
+/** Compare against std::unordered_map over random inserts and erases. */
+TEST(AddressIndexTest, Random)
+{
+    const size_t capacity = 64u;
+    AddressIndex index(capacity);
+    std::unordered_map<Addr, int> reference;
+    std::mt19937 rng(1);
+
+    for (int i = 0; i < 100000; i++) {
+        // Few distinct addresses, so probe sequences collide often.
+        Addr address = (rng() % 128) << 6;
+        if (reference.count(address) || reference.size() == capacity) {
+            index.erase(address);
+            reference.erase(address);
+        } else {
+            index.insert(address, i);
+            reference[address] = i;
+        }
+
+        ASSERT_EQ(reference.size(), size_t(index.size()));
+        Addr probe = (rng() % 128) << 6;
+        auto it = reference.find(probe);
+        ASSERT_EQ(it == reference.end() ? -1 : it->second,
+                  index.lookup(probe));
+    }
+}
@@ -101,6 +101,7 @@ CacheMemory::init()
 
     m_cache.resize(m_cache_num_sets,
                     std::vector<AbstractCacheEntry*>(m_cache_assoc, nullptr));
+    m_tag_index.init(m_cache_num_sets * m_cache_assoc);
     replacement_data.resize(m_cache_num_sets,
                                std::vector<ReplData>(m_cache_assoc, nullptr));
     // instantiate all the replacement_data here
@@ -139,11 +140,11 @@ CacheMemory::findTagInSet(int64_t cacheSet, Addr tag) const
 {
     assert(tag == makeLineAddress(tag));
     // search the set for the tags
-    auto it = m_tag_index.find(tag);
-    if (it != m_tag_index.end())
-        if (m_cache[cacheSet][it->second]->m_Permission !=
+    int way = m_tag_index.lookup(tag);
+    if (way >= 0)
+        if (m_cache[cacheSet][way]->m_Permission !=
             AccessPermission_NotPresent)
-            return it->second;
+            return way;
     return -1; // Not found
 }
 
@@ -155,10 +156,7 @@ CacheMemory::findTagInSetIgnorePermissions(int64_t cacheSet,
 {
     assert(tag == makeLineAddress(tag));
     // search the set for the tags
-    auto it = m_tag_index.find(tag);
-    if (it != m_tag_index.end())
-        return it->second;
-    return -1; // Not found
+    return m_tag_index.lookup(tag); // -1 if not found
 }
 
 // Given an unique cache block identifier (idx): return the valid address
@@ -298,13 +296,17 @@ CacheMemory::allocate(Addr address, AbstractCacheEntry *entry)
                     "leak here. Fix your protocol to eliminate these!",
                     address);
             }
+            // Drop the tag of the NotPresent entry being replaced, so it
+            // can't be found in this way any more
+            if (set[i] && m_tag_index.lookup(set[i]->m_Address) == i)
+                m_tag_index.erase(set[i]->m_Address);
             set[i] = entry;  // Init entry
             set[i]->m_Address = address;
             set[i]->m_Permission = AccessPermission_Invalid;
             DPRINTF(RubyCache, "Allocate clearing lock for addr: 0x%x\n",
                     address);
             set[i]->m_locked = -1;
-            m_tag_index[address] = i;
+            m_tag_index.insert(address, i);
             set[i]->setPosition(cacheSet, i);
             set[i]->replacementData = replacement_data[cacheSet][i];
             set[i]->setLastAccess(curTick());
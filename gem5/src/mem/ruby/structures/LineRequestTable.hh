@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_STRUCTURES_LINEREQUESTTABLE_HH__
+#define __MEM_RUBY_STRUCTURES_LINEREQUESTTABLE_HH__
+
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "mem/ruby/common/Address.hh"
+#include "mem/ruby/structures/AddressIndex.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * Outstanding requests grouped by cache line, in the order they were
+ * made, replacing std::unordered_map<Addr, std::list<REQUEST>>.
+ *
+ * Requests and lines live in pools sized for the expected number of
+ * outstanding requests and are recycled, so the table doesn't allocate
+ * once it has warmed up. Lines are found with an AddressIndex. Pools only
+ * grow, and never move their elements, so a request stays valid while new
+ * requests are added, e.g., by a callback made while processing it.
+ */
+template <class REQUEST>
+class LineRequestTable
+{
+  public:
+    /** The requests to one line, used like a std::list. */
+    class Line
+    {
+      public:
+        bool empty() const { return m_size == 0; }
+        int size() const { return m_size; }
+
+        REQUEST &front() { return *m_table->m_nodes[m_head].request; }
+
+        template <typename... Args>
+        void
+        emplace_back(Args&&... args)
+        {
+            int node = m_table->allocateNode(std::forward<Args>(args)...);
+            if (m_tail < 0)
+                m_head = node;
+            else
+                m_table->m_nodes[m_tail].next = node;
+            m_tail = node;
+            m_size++;
+        }
+
+        void
+        pop_front()
+        {
+            assert(m_size > 0);
+            int node = m_head;
+            m_head = m_table->m_nodes[node].next;
+            if (m_head < 0)
+                m_tail = -1;
+            m_size--;
+            m_table->freeNode(node);
+        }
+
+        /** Call f(request) for every request, oldest first. */
+        template <typename F>
+        void
+        forEach(F f) const
+        {
+            for (int node = m_head; node >= 0;
+                 node = m_table->m_nodes[node].next) {
+                f(static_cast<const REQUEST &>(
+                    *m_table->m_nodes[node].request));
+            }
+        }
+
+      private:
+        friend class LineRequestTable;
+
+        LineRequestTable *m_table = nullptr;
+        int m_head = -1;
+        int m_tail = -1;
+        int m_size = 0;
+    };
+
+    LineRequestTable(int capacity = 0)
+    {
+        init(capacity);
+    }
+
+    // Lines point back to their table
+    LineRequestTable(const LineRequestTable &) = delete;
+    LineRequestTable &operator=(const LineRequestTable &) = delete;
+
+    /** Clear the table and size it for capacity outstanding requests. */
+    void
+    init(int capacity)
+    {
+        m_nodes.clear();
+        m_free_nodes.clear();
+        m_lines.clear();
+        m_free_lines.clear();
+        m_index.init(capacity);
+        for (int i = 0; i < capacity; i++) {
+            m_nodes.emplace_back();
+            m_free_nodes.push_back(capacity - 1 - i);
+            m_lines.emplace_back();
+            m_free_lines.push_back(capacity - 1 - i);
+        }
+    }
+
+    /** Returns the requests to address, adding the line if needed. */
+    Line &
+    operator[](Addr address)
+    {
+        int slot = m_index.lookup(address);
+        if (slot >= 0)
+            return m_lines[slot];
+
+        if (m_free_lines.empty()) {
+            m_free_lines.push_back(m_lines.size());
+            m_lines.emplace_back();
+        }
+        slot = m_free_lines.back();
+        m_free_lines.pop_back();
+
+        if (m_index.size() == m_index.capacity())
+            growIndex();
+        m_index.insert(address, slot);
+
+        Line &line = m_lines[slot];
+        line.m_table = this;
+        return line;
+    }
+
+    bool contains(Addr address) const { return m_index.lookup(address) >= 0; }
+
+    /** Remove the line of address, which must have no requests left. */
+    void
+    erase(Addr address)
+    {
+        int slot = m_index.lookup(address);
+        if (slot < 0)
+            return;
+        assert(m_lines[slot].empty());
+        m_index.erase(address);
+        m_free_lines.push_back(slot);
+    }
+
+    bool empty() const { return m_index.size() == 0; }
+
+    /** Number of lines with outstanding requests. */
+    int size() const { return m_index.size(); }
+
+    /** Call f(address, line) for every line. */
+    template <typename F>
+    void
+    forEach(F f) const
+    {
+        m_index.forEach([&](Addr address, int slot) {
+            f(address, static_cast<const Line &>(m_lines[slot]));
+        });
+    }
+
+  private:
+    struct Node
+    {
+        std::optional<REQUEST> request;
+        int next = -1;
+    };
+
+    template <typename... Args>
+    int
+    allocateNode(Args&&... args)
+    {
+        if (m_free_nodes.empty()) {
+            m_free_nodes.push_back(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+        int node = m_free_nodes.back();
+        m_free_nodes.pop_back();
+        m_nodes[node].request.emplace(std::forward<Args>(args)...);
+        m_nodes[node].next = -1;
+        return node;
+    }
+
+    void
+    freeNode(int node)
+    {
+        m_nodes[node].request.reset();
+        m_free_nodes.push_back(node);
+    }
+
+    void
+    growIndex()
+    {
+        AddressIndex old_index = m_index;
+        m_index.init(std::max(1, 2 * old_index.capacity()));
+        old_index.forEach([&](Addr address, int slot) {
+            m_index.insert(address, slot);
+        });
+    }
+
+    std::deque<Node> m_nodes;
+    std::vector<int> m_free_nodes;
+    std::deque<Line> m_lines;
+    std::vector<int> m_free_lines;
+    AddressIndex m_index;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_STRUCTURES_LINEREQUESTTABLE_HH__
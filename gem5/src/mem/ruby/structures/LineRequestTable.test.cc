@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "mem/ruby/structures/LineRequestTable.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+namespace
+{
+
+// No default constructor, like SequencerRequest
+struct Request
+{
+    Request(int _id) : id(_id) {}
+    int id;
+};
+
+std::vector<int>
+ids(const LineRequestTable<Request>::Line &line)
+{
+    std::vector<int> result;
+    line.forEach([&](const Request &request) {
+        result.push_back(request.id);
+    });
+    return result;
+}
+
+} // anonymous namespace
+
+TEST(LineRequestTableTest, InOrderPerLine)
+{
+    LineRequestTable<Request> table(4);
+    EXPECT_TRUE(table.empty());
+    EXPECT_FALSE(table.contains(0x40));
+
+    table[0x40].emplace_back(1);
+    table[0x80].emplace_back(2);
+    table[0x40].emplace_back(3);
+    EXPECT_TRUE(table.contains(0x40));
+    EXPECT_EQ(2, table.size());
+    EXPECT_EQ(2, table[0x40].size());
+    EXPECT_EQ((std::vector<int>{1, 3}), ids(table[0x40]));
+
+    auto &line = table[0x40];
+    EXPECT_EQ(1, line.front().id);
+    line.pop_front();
+    EXPECT_EQ(3, line.front().id);
+    line.pop_front();
+    EXPECT_TRUE(line.empty());
+
+    table.erase(0x40);
+    EXPECT_FALSE(table.contains(0x40));
+    EXPECT_EQ(1, table.size());
+}
+
+TEST(LineRequestTableTest, AddWhileProcessing)
+{
+    LineRequestTable<Request> table(1);
+    auto &line = table[0x40];
+    line.emplace_back(1);
+    Request &first = line.front();
+
+    // Going over capacity must not move the request being processed.
+    for (int i = 2; i <= 8; i++)
+        line.emplace_back(i);
+    EXPECT_EQ(&first, &line.front());
+    EXPECT_EQ(8, line.size());
+}
+
+TEST(LineRequestTableTest, GrowsPastCapacity)
+{
+    LineRequestTable<Request> table(2);
+    for (int i = 0; i < 32; i++)
+        table[i * 0x40].emplace_back(i);
+    EXPECT_EQ(32, table.size());
+
+    int count = 0;
+    table.forEach([&](Addr address,
+                      const LineRequestTable<Request>::Line &line) {
+        EXPECT_EQ((std::vector<int>{int(address / 0x40)}), ids(line));
+        count++;
+    });
+    EXPECT_EQ(32, count);
+
+    // Freed requests and lines are reused.
+    for (int i = 0; i < 32; i++) {
+        table[i * 0x40].pop_front();
+        table.erase(i * 0x40);
+    }
+    EXPECT_TRUE(table.empty());
+    table[0x40].emplace_back(42);
+    EXPECT_EQ(42, table[0x40].front().id);
+}
@@ -54,8 +54,12 @@ MN_TBETable::chooseNewDistributor()
     std::vector<MiscNode_TBE*> potential_sync_dependency_tbes;
     bool has_waiting_sync = false;
     int waiting_count = 0;
-    for (auto& keyValuePair : m_map) {
-        MiscNode_TBE& tbe = keyValuePair.second;
+    std::vector<MiscNode_TBE*> tbes;
+    m_index.forEach([&](Addr address, int slot) {
+        tbes.push_back(&m_entries[slot]);
+    });
+    for (MiscNode_TBE* tbe_ptr : tbes) {
+        MiscNode_TBE& tbe = *tbe_ptr;
 
         switch (tbe.getstate()) {
             case MiscNode_State_DvmSync_Distributing:
@@ -41,10 +41,12 @@
 #ifndef __MEM_RUBY_STRUCTURES_TBETABLE_HH__
 #define __MEM_RUBY_STRUCTURES_TBETABLE_HH__
 
+#include <deque>
 #include <iostream>
-#include <unordered_map>
+#include <vector>
 
 #include "mem/ruby/common/Address.hh"
+#include "mem/ruby/structures/AddressIndex.hh"
 
 namespace gem5
 {
@@ -57,7 +59,7 @@ class TBETable
 {
   public:
     TBETable(int number_of_TBEs)
-        : m_number_of_TBEs(number_of_TBEs)
+        : m_index(number_of_TBEs), m_number_of_TBEs(number_of_TBEs)
     {
     }
 
@@ -67,7 +69,7 @@ class TBETable
     bool
     areNSlotsAvailable(int n, Tick current_time) const
     {
-        return (m_number_of_TBEs - m_map.size()) >= n;
+        return (m_number_of_TBEs - m_index.size()) >= n;
     }
 
     ENTRY *getNullEntry();
@@ -82,7 +84,12 @@ class TBETable
     TBETable& operator=(const TBETable& obj);
 
     // Data Members (m_prefix)
-    std::unordered_map<Addr, ENTRY> m_map;
+    // The slot of each allocated TBE in m_entries. Entries are never moved
+    // or freed, so pointers returned by lookup stay valid until the TBE is
+    // deallocated, and slots are reused without allocating memory.
+    AddressIndex m_index;
+    std::deque<ENTRY> m_entries;
+    std::vector<int> m_free_slots;
 
   private:
     int m_number_of_TBEs;
@@ -102,8 +109,8 @@ inline bool
 TBETable<ENTRY>::isPresent(Addr address) const
 {
     assert(address == makeLineAddress(address));
-    assert(m_map.size() <= m_number_of_TBEs);
-    return !!m_map.count(address);
+    assert(m_index.size() <= m_number_of_TBEs);
+    return m_index.lookup(address) >= 0;
 }
 
 template<class ENTRY>
@@ -111,8 +118,17 @@ inline void
 TBETable<ENTRY>::allocate(Addr address)
 {
     assert(!isPresent(address));
-    assert(m_map.size() < m_number_of_TBEs);
-    m_map[address] = ENTRY();
+    assert(m_index.size() < m_number_of_TBEs);
+    // Free slots were reset when their TBE was deallocated
+    int slot;
+    if (m_free_slots.empty()) {
+        slot = m_entries.size();
+        m_entries.emplace_back();
+    } else {
+        slot = m_free_slots.back();
+        m_free_slots.pop_back();
+    }
+    m_index.insert(address, slot);
 }
 
 template<class ENTRY>
@@ -120,8 +136,11 @@ inline void
 TBETable<ENTRY>::deallocate(Addr address)
 {
     assert(isPresent(address));
-    assert(m_map.size() > 0);
-    m_map.erase(address);
+    assert(m_index.size() > 0);
+    int slot = m_index.lookup(address);
+    m_index.erase(address);
+    m_entries[slot] = ENTRY();
+    m_free_slots.push_back(slot);
 }
 
 template<class ENTRY>
@@ -136,8 +155,10 @@ template<class ENTRY>
 inline ENTRY*
 TBETable<ENTRY>::lookup(Addr address)
 {
-  if (m_map.find(address) != m_map.end()) return &(m_map.find(address)->second);
-  return NULL;
+    int slot = m_index.lookup(address);
+    if (slot >= 0)
+        return &m_entries[slot];
+    return NULL;
 }
 
 
@@ -31,8 +31,10 @@
 
 #include "debug/RubyCacheTrace.hh"
 #include "mem/packet.hh"
+#include "mem/ruby/slicc_interface/AbstractController.hh"
 #include "mem/ruby/system/RubySystem.hh"
 #include "mem/ruby/system/Sequencer.hh"
+#include "mem/ruby/system/TraceInstall.hh"
 #include "sim/sim_exit.hh"
 
 namespace gem5
@@ -124,8 +126,15 @@ CacheRecorder::enqueueNextFetchRequest()
 
         DPRINTF(RubyCacheTrace, "Issuing %s\n", *traceRecord);
 
+        uint64_t block = m_records_read *
+            (m_block_size_bytes / RubySystem::getBlockSizeBytes());
         for (int rec_bytes_read = 0; rec_bytes_read < m_block_size_bytes;
-                rec_bytes_read += RubySystem::getBlockSizeBytes()) {
+                rec_bytes_read += RubySystem::getBlockSizeBytes(), block++) {
+            // Skip the blocks that were installed by installRecords()
+            if (!m_replay_blocks.empty() && !m_replay_blocks[block]) {
+                continue;
+            }
+
             RequestPtr req;
             MemCmd::Command requestType;
 
@@ -168,6 +177,43 @@ CacheRecorder::enqueueNextFetchRequest()
     }
 }
 
+uint64_t
+CacheRecorder::installRecords(
+    const std::vector<AbstractController*>& controllers)
+{
+    DataBlock block;
+
+    auto install = [&](const TraceRecord& rec, Addr addr) {
+        AbstractController* cntrl = controllers[rec.m_cntrl_id];
+        MachineID holder = cntrl->getMachineID();
+        block.setData(rec.m_data + (addr - rec.m_data_address), 0,
+                      RubySystem::getBlockSizeBytes());
+
+        if (!cntrl->functionalWarmup(addr, rec.m_type, block, holder)) {
+            return false;
+        }
+
+        for (auto other : controllers) {
+            if (other != cntrl) {
+                other->functionalWarmup(addr, rec.m_type, block, holder);
+            }
+        }
+
+        DPRINTF(RubyCacheTrace, "Installed %#x of %s\n", addr, rec);
+        return true;
+    };
+
+    uint64_t records_installed = installTraceRecords(
+        m_uncompressed_trace, m_uncompressed_trace_size, m_block_size_bytes,
+        RubySystem::getBlockSizeBytes(), m_replay_blocks, install);
+
+    DPRINTF(RubyCacheTrace, "Installed %d records, %d left to replay\n",
+            records_installed,
+            m_uncompressed_trace_size /
+            (sizeof(TraceRecord) + m_block_size_bytes));
+    return records_installed;
+}
+
 void
 CacheRecorder::addRecord(int cntrl, Addr data_addr, Addr pc_addr,
                          RubyRequestType type, Tick time, DataBlock& data)
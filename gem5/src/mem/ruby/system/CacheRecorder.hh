@@ -49,6 +49,7 @@ namespace gem5
 namespace ruby
 {
 
+class AbstractController;
 class Sequencer;
 class RubyPort;
 /*!
@@ -106,6 +107,18 @@ class CacheRecorder
      */
     void enqueueNextFetchRequest();
 
+    /*!
+     * Function for installing the recorded cache contents directly into
+     * the controllers, without issuing any requests. Each block is offered
+     * to the controller that recorded it and, if it accepts, to all other
+     * controllers so they can update their directory state. Declined
+     * blocks stay in the trace, in their original order, and are later
+     * replayed by enqueueNextFetchRequest(). Returns the number of records
+     * installed.
+     */
+    uint64_t installRecords(
+        const std::vector<AbstractController*>& controllers);
+
   private:
     // Private copy constructor and assignment operator
     CacheRecorder(const CacheRecorder& obj);
@@ -119,6 +132,8 @@ class CacheRecorder
     uint64_t m_records_read;
     uint64_t m_records_flushed;
     uint64_t m_block_size_bytes;
+    //! Blocks of each record left to replay, when some were installed
+    std::vector<bool> m_replay_blocks;
 };
 
 inline bool
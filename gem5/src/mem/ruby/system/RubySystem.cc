@@ -78,7 +78,7 @@ bool RubySystem::m_cooldown_enabled = false;
 
 RubySystem::RubySystem(const Params &p)
     : ClockedObject(p), m_access_backing_store(p.access_backing_store),
-      m_cache_recorder(NULL)
+      m_functional_warmup(p.functional_warmup), m_cache_recorder(NULL)
 {
     m_randomization = p.randomization;
 
@@ -449,6 +449,12 @@ RubySystem::startup()
     // state was checkpointed.
 
     if (m_warmup_enabled) {
+        // Protocols that support it take their state straight from the
+        // trace; whatever they decline is replayed below.
+        if (m_functional_warmup) {
+            m_cache_recorder->installRecords(m_abs_cntrl_vec);
+        }
+
         DPRINTF(RubyCacheTrace, "Starting ruby cache warmup\n");
         // save the current tick value
         Tick curtick_original = curTick();
@@ -501,6 +507,7 @@ RubySystem::resetStats()
     for (auto& network : m_networks) {
         network->resetStats();
     }
+    m_profiler->resetStats();
     ClockedObject::resetStats();
 }
 
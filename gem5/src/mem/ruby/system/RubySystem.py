@@ -57,8 +57,29 @@ class RubySystem(ClockedObject):
         store and only use ruby for timing.",
     )
 
+    functional_warmup = Param.Bool(
+        False,
+        "Install checkpointed cache contents directly into the controllers \
+         of protocols that support it, instead of replaying them as \
+         requests. Blocks that a protocol declines are still replayed.",
+    )
+
     # Profiler related configuration variables
     hot_lines = Param.Bool(False, "")
     all_instructions = Param.Bool(False, "")
+    sharing_profiler_sample_rate = Param.UInt32(
+        0,
+        "profile sharing and contention on 1 in N cache lines and report "
+        "the hottest ones at each stats dump; 0 disables the profiler. "
+        "Sharers are only dropped on evictions reported by controllers "
+        "with send_evictions set, so the sharer and invalidation counts "
+        "are overestimates otherwise",
+    )
+    sharing_profiler_entries = Param.UInt32(
+        4096, "number of lines tracked by the sharing profiler"
+    )
+    sharing_profiler_top_lines = Param.UInt32(
+        20, "number of lines in the sharing profiler report"
+    )
     num_of_sequencers = Param.Int("")
     number_of_virtual_networks = Param.Unsigned("")
@@ -54,6 +54,7 @@
 #include "debug/RubyStats.hh"
 #include "mem/packet.hh"
 #include "mem/ruby/profiler/Profiler.hh"
+#include "mem/ruby/profiler/SharingProfiler.hh"
 #include "mem/ruby/protocol/PrefetchBit.hh"
 #include "mem/ruby/protocol/RubyAccessMode.hh"
 #include "mem/ruby/slicc_interface/RubyRequest.hh"
@@ -69,12 +70,25 @@ namespace ruby
 
 Sequencer::Sequencer(const Params &p)
     : RubyPort(p), m_IncompleteTimes(MachineType_NUM),
+      m_aliasedRequests(this, "aliasedRequests",
+                        statistics::units::Count::get(),
+                        "Requests made to a line which already had an "
+                        "outstanding request"),
+      m_coalescedRequests(this, "coalescedRequests",
+                          statistics::units::Count::get(),
+                          "Aliased requests completed by the response to "
+                          "an earlier request"),
+      m_reissuedRequests(this, "reissuedRequests",
+                         statistics::units::Count::get(),
+                         "Aliased requests issued again once the earlier "
+                         "request completed"),
       deadlockCheckEvent([this]{ wakeup(); }, "Sequencer deadlock check")
 {
     m_outstanding_count = 0;
 
     m_dataCache_ptr = p.dcache;
     m_max_outstanding_requests = p.max_outstanding_requests;
+    m_RequestTable.init(m_max_outstanding_requests);
     m_deadlock_threshold = p.deadlock_threshold;
 
     m_coreId = p.coreid; // for tracking the two CorePair sequencers
@@ -234,21 +248,21 @@ Sequencer::wakeup()
     // Check across all outstanding requests
     [[maybe_unused]] int total_outstanding = 0;
 
-    for (const auto &table_entry : m_RequestTable) {
-        for (const auto &seq_req : table_entry.second) {
+    m_RequestTable.forEach([&](Addr, const auto &seq_req_list) {
+        seq_req_list.forEach([&](const SequencerRequest &seq_req) {
             if (current_time - seq_req.issue_time < m_deadlock_threshold)
-                continue;
+                return;
 
             panic("Possible Deadlock detected. Aborting!\n version: %d "
                   "request.paddr: 0x%x m_readRequestTable: %d current time: "
                   "%u issue_time: %d difference: %d\n", m_version,
-                  seq_req.pkt->getAddr(), table_entry.second.size(),
+                  seq_req.pkt->getAddr(), seq_req_list.size(),
                   current_time * clockPeriod(), seq_req.issue_time
                   * clockPeriod(), (current_time * clockPeriod())
                   - (seq_req.issue_time * clockPeriod()));
-        }
-        total_outstanding += table_entry.second.size();
-    }
+        });
+        total_outstanding += seq_req_list.size();
+    });
 
     assert(m_outstanding_count == total_outstanding);
 
@@ -263,12 +277,12 @@ Sequencer::functionalWrite(Packet *func_pkt)
 {
     int num_written = RubyPort::functionalWrite(func_pkt);
 
-    for (const auto &table_entry : m_RequestTable) {
-        for (const auto& seq_req : table_entry.second) {
+    m_RequestTable.forEach([&](Addr, const auto &seq_req_list) {
+        seq_req_list.forEach([&](const SequencerRequest &seq_req) {
             if (seq_req.functionalWrite(func_pkt))
                 ++num_written;
-        }
-    }
+        });
+    });
 
     return num_written;
 }
@@ -368,6 +382,7 @@ Sequencer::insertRequest(PacketPtr pkt, RubyRequestType primary_type,
     m_outstanding_count++;
 
     if (seq_req_list.size() > 1) {
+        m_aliasedRequests++;
         return RequestStatus_Aliased;
     }
 
@@ -468,7 +483,7 @@ Sequencer::writeCallback(Addr address, DataBlock& data,
     // to this cache line when response for the write comes back
     //
     assert(address == makeLineAddress(address));
-    assert(m_RequestTable.find(address) != m_RequestTable.end());
+    assert(m_RequestTable.contains(address));
     auto &seq_req_list = m_RequestTable[address];
 
     // Perform hitCallback on every cpu request made to this cache block while
@@ -487,6 +502,7 @@ Sequencer::writeCallback(Addr address, DataBlock& data,
             // (e.g. if full line no present)
             // Reissue to the cache hierarchy
             issueRequest(seq_req.pkt, seq_req.m_second_type);
+            m_reissuedRequests++;
             break;
         }
 
@@ -537,6 +553,10 @@ Sequencer::writeCallback(Addr address, DataBlock& data,
                                   firstResponseTime);
             }
 
+            if (!ruby_request) {
+                m_coalescedRequests++;
+            }
+
             markRemoved();
             hitCallback(&seq_req, data, success, mach, externalHit,
                         initialRequestTime, forwardRequestTime,
@@ -545,6 +565,7 @@ Sequencer::writeCallback(Addr address, DataBlock& data,
         } else {
             // handle read request
             assert(!ruby_request);
+            m_coalescedRequests++;
             markRemoved();
             hitCallback(&seq_req, data, true, mach, externalHit,
                         initialRequestTime, forwardRequestTime,
@@ -571,7 +592,7 @@ Sequencer::readCallback(Addr address, DataBlock& data,
     // or end of the corresponding list.
     //
     assert(address == makeLineAddress(address));
-    assert(m_RequestTable.find(address) != m_RequestTable.end());
+    assert(m_RequestTable.contains(address));
     auto &seq_req_list = m_RequestTable[address];
 
     // Perform hitCallback on every cpu request made to this cache block while
@@ -591,12 +612,15 @@ Sequencer::readCallback(Addr address, DataBlock& data,
             (seq_req.m_type != RubyRequestType_REPLACEMENT)) {
             // Write request: reissue request to the cache hierarchy
             issueRequest(seq_req.pkt, seq_req.m_second_type);
+            m_reissuedRequests++;
             break;
         }
         if (ruby_request) {
             recordMissLatency(&seq_req, true, mach, externalHit,
                               initialRequestTime, forwardRequestTime,
                               firstResponseTime);
+        } else {
+            m_coalescedRequests++;
         }
         markRemoved();
         hitCallback(&seq_req, data, true, mach, externalHit,
@@ -626,7 +650,7 @@ Sequencer::atomicCallback(Addr address, DataBlock& data,
     // (the opperation could be performed remotly)
     //
     assert(address == makeLineAddress(address));
-    assert(m_RequestTable.find(address) != m_RequestTable.end());
+    assert(m_RequestTable.contains(address));
     auto &seq_req_list = m_RequestTable[address];
 
     // Perform hitCallback only on the first cpu request that
@@ -648,6 +672,7 @@ Sequencer::atomicCallback(Addr address, DataBlock& data,
             // reissue request to the cache hierarchy
             // (we don't know if op was performed remotly)
             issueRequest(seq_req.pkt, seq_req.m_second_type);
+            m_reissuedRequests++;
             break;
         }
 
@@ -699,6 +724,16 @@ Sequencer::hitCallback(SequencerRequest* srequest, DataBlock& data,
         llscLoadLinked(line_addr);
     }
 
+    SharingProfiler *sharing_profiler =
+        m_ruby_system->getProfiler()->getSharingProfiler();
+    if (sharing_profiler) {
+        Addr line_addr = makeLineAddress(request_address);
+        if (sharing_profiler->isSampled(line_addr)) {
+            sharing_profiler->profileAccess(line_addr, m_version,
+                pkt->isWrite() || pkt->isAtomicOp());
+        }
+    }
+
     DPRINTF(RubyHitMiss, "Cache %s at %#x\n",
                          externalHit ? "miss" : "hit",
                          printAddress(request_address));
@@ -887,7 +922,7 @@ Sequencer::invL1()
         Addr addr = m_dataCache_ptr->getAddressAtIdx(i);
         // Evict Read-only data
         RubyRequestType request_type = RubyRequestType_REPLACEMENT;
-        std::shared_ptr<RubyRequest> msg = std::make_shared<RubyRequest>(
+        std::shared_ptr<RubyRequest> msg = RubyRequest::create(
             clockEdge(), addr, 0, 0,
             request_type, RubyAccessMode_Supervisor,
             nullptr);
@@ -1062,10 +1097,10 @@ Sequencer::issueRequest(PacketPtr pkt, RubyRequestType secondary_type)
     // requests do not
     std::shared_ptr<RubyRequest> msg;
     if (pkt->req->isMemMgmt()) {
-        msg = std::make_shared<RubyRequest>(clockEdge(),
-                                            pc, secondary_type,
-                                            RubyAccessMode_Supervisor, pkt,
-                                            proc_id, core_id);
+        msg = RubyRequest::create(clockEdge(),
+                                  pc, secondary_type,
+                                  RubyAccessMode_Supervisor, pkt,
+                                  proc_id, core_id);
 
         DPRINTFR(ProtocolTrace, "%15s %3s %10s%20s %6s>%-6s %s\n",
                 curTick(), m_version, "Seq", "Begin", "", "",
@@ -1089,10 +1124,10 @@ Sequencer::issueRequest(PacketPtr pkt, RubyRequestType secondary_type)
                     msg->m_tlbiTransactionUid);
         }
     } else {
-        msg = std::make_shared<RubyRequest>(clockEdge(), pkt->getAddr(),
-                                            pkt->getSize(), pc, secondary_type,
-                                            RubyAccessMode_Supervisor, pkt,
-                                            PrefetchBit_No, proc_id, core_id);
+        msg = RubyRequest::create(clockEdge(), pkt->getAddr(),
+                                  pkt->getSize(), pc, secondary_type,
+                                  RubyAccessMode_Supervisor, pkt,
+                                  PrefetchBit_No, proc_id, core_id);
 
         if (pkt->isAtomicOp() &&
             ((secondary_type == RubyRequestType_ATOMIC_RETURN) ||
@@ -1128,16 +1163,15 @@ Sequencer::issueRequest(PacketPtr pkt, RubyRequestType secondary_type)
     m_mandatory_q_ptr->enqueue(msg, clockEdge(), latency);
 }
 
-template <class KEY, class VALUE>
 std::ostream &
-operator<<(std::ostream &out, const std::unordered_map<KEY, VALUE> &map)
+operator<<(std::ostream &out, const LineRequestTable<SequencerRequest> &table)
 {
-    for (const auto &table_entry : map) {
-        out << "[ " << table_entry.first << " =";
-        for (const auto &seq_req : table_entry.second) {
+    table.forEach([&](Addr address, const auto &seq_req_list) {
+        out << "[ " << address << " =";
+        seq_req_list.forEach([&](const SequencerRequest &seq_req) {
             out << " " << RubyRequestType_to_string(seq_req.m_second_type);
-        }
-    }
+        });
+    });
     out << " ]";
 
     return out;
@@ -1162,6 +1196,16 @@ void
 Sequencer::evictionCallback(Addr address)
 {
     llscClearMonitor(address);
+
+    SharingProfiler *sharing_profiler =
+        m_ruby_system->getProfiler()->getSharingProfiler();
+    if (sharing_profiler) {
+        Addr line_addr = makeLineAddress(address);
+        if (sharing_profiler->isSampled(line_addr)) {
+            sharing_profiler->profileEviction(line_addr, m_version);
+        }
+    }
+
     ruby_eviction_callback(address);
 }
 
@@ -42,7 +42,6 @@
 #define __MEM_RUBY_SYSTEM_SEQUENCER_HH__
 
 #include <iostream>
-#include <list>
 #include <unordered_map>
 
 #include "mem/ruby/common/Address.hh"
@@ -50,6 +49,7 @@
 #include "mem/ruby/protocol/RubyRequestType.hh"
 #include "mem/ruby/protocol/SequencerRequestType.hh"
 #include "mem/ruby/structures/CacheMemory.hh"
+#include "mem/ruby/structures/LineRequestTable.hh"
 #include "mem/ruby/system/RubyPort.hh"
 #include "params/RubySequencer.hh"
 
@@ -233,7 +233,7 @@ class Sequencer : public RubyPort
 
   protected:
     // RequestTable contains both read and write requests, handles aliasing
-    std::unordered_map<Addr, std::list<SequencerRequest>> m_RequestTable;
+    LineRequestTable<SequencerRequest> m_RequestTable;
     // UnadressedRequestTable contains "unaddressed" requests,
     // guaranteed not to alias each other
     std::unordered_map<uint64_t, SequencerRequest> m_UnaddressedRequestTable;
@@ -305,6 +305,13 @@ class Sequencer : public RubyPort
     std::vector<statistics::Histogram *> m_FirstResponseToCompletionDelayHist;
     std::vector<statistics::Counter> m_IncompleteTimes;
 
+    //! Requests made to a line which already had an outstanding request
+    statistics::Scalar m_aliasedRequests;
+    //! Aliased requests completed by the response to an earlier request
+    statistics::Scalar m_coalescedRequests;
+    //! Aliased requests issued again once the earlier request completed
+    statistics::Scalar m_reissuedRequests;
+
     EventFunctionWrapper deadlockCheckEvent;
 
     // support for LL/SC
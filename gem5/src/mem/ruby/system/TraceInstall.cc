@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "mem/ruby/system/TraceInstall.hh"
+
+#include <cstring>
+#include <unordered_set>
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+uint64_t
+installTraceRecords(
+    uint8_t *trace, uint64_t &trace_size, uint64_t record_block_bytes,
+    uint64_t block_size_bytes, std::vector<bool> &replay,
+    const std::function<bool(const TraceRecord &, Addr)> &install)
+{
+    uint64_t record_size = sizeof(TraceRecord) + record_block_bytes;
+    uint64_t blocks_per_record = record_block_bytes / block_size_bytes;
+    uint64_t bytes_kept = 0;
+    uint64_t records_installed = 0;
+    std::unordered_set<Addr> declined;
+    std::vector<bool> pending(blocks_per_record);
+
+    replay.clear();
+
+    for (uint64_t bytes_read = 0; bytes_read < trace_size;
+            bytes_read += record_size) {
+        TraceRecord *rec = (TraceRecord *) (trace + bytes_read);
+        bool keep = false;
+
+        for (uint64_t i = 0; i < blocks_per_record; i++) {
+            Addr addr = rec->m_data_address + i * block_size_bytes;
+            pending[i] = declined.count(addr) || !install(*rec, addr);
+            if (pending[i]) {
+                declined.insert(addr);
+                keep = true;
+            }
+        }
+
+        if (!keep) {
+            records_installed++;
+            continue;
+        }
+
+        if (bytes_kept != bytes_read) {
+            memmove(trace + bytes_kept, rec, record_size);
+        }
+        bytes_kept += record_size;
+        replay.insert(replay.end(), pending.begin(), pending.end());
+    }
+
+    trace_size = bytes_kept;
+    return records_installed;
+}
+
+} // namespace ruby
+} // namespace gem5
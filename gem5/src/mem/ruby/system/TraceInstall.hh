@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef __MEM_RUBY_SYSTEM_TRACEINSTALL_HH__
+#define __MEM_RUBY_SYSTEM_TRACEINSTALL_HH__
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/ruby/system/CacheRecorder.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/*!
+ * Offers the blocks of a cache trace to install(), one block of
+ * block_size_bytes at a time and in trace order, and compacts the trace
+ * down to the records that still have to be replayed through the
+ * sequencers. Records hold record_block_bytes of data, a multiple of
+ * block_size_bytes.
+ *
+ * Once a block is declined, every later record for the same block is kept
+ * too, without offering it, so that the replay applies the records for a
+ * line in their original order. A record that is only partly installed is
+ * kept, and replay gets one flag per block of each kept record, set for
+ * the blocks that still have to be replayed.
+ *
+ * Returns the number of records that were fully installed.
+ */
+uint64_t installTraceRecords(
+    uint8_t *trace, uint64_t &trace_size, uint64_t record_block_bytes,
+    uint64_t block_size_bytes, std::vector<bool> &replay,
+    const std::function<bool(const TraceRecord &, Addr)> &install);
+
+} // namespace ruby
+} // namespace gem5
+
+#endif //__MEM_RUBY_SYSTEM_TRACEINSTALL_HH__
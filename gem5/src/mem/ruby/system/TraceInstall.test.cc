@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "mem/ruby/system/TraceInstall.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+namespace
+{
+
+const uint64_t blockSize = 64;
+
+// Builds a trace of records holding blocks_per_record blocks each, with
+// the first data byte of each record set to its index.
+std::vector<uint8_t>
+makeTrace(const std::vector<std::pair<int, Addr>> &records,
+          uint64_t blocks_per_record)
+{
+    uint64_t record_size = sizeof(TraceRecord) +
+                           blocks_per_record * blockSize;
+    std::vector<uint8_t> trace(records.size() * record_size, 0);
+
+    for (size_t i = 0; i < records.size(); i++) {
+        TraceRecord *rec = (TraceRecord *) (trace.data() + i * record_size);
+        rec->m_cntrl_id = records[i].first;
+        rec->m_data_address = records[i].second;
+        rec->m_data[0] = i;
+    }
+    return trace;
+}
+
+const TraceRecord &
+recordAt(const std::vector<uint8_t> &trace, uint64_t blocks_per_record,
+         size_t i)
+{
+    uint64_t record_size = sizeof(TraceRecord) +
+                           blocks_per_record * blockSize;
+    return *(const TraceRecord *) (trace.data() + i * record_size);
+}
+
+} // anonymous namespace
+
+TEST(TraceInstallTest, AllInstalled)
+{
+    auto trace = makeTrace({{0, 0x0}, {1, 0x40}, {0, 0x80}}, 1);
+    uint64_t size = trace.size();
+    std::vector<bool> replay;
+    std::vector<Addr> installed;
+
+    uint64_t n = installTraceRecords(trace.data(), size, blockSize,
+        blockSize, replay,
+        [&](const TraceRecord &rec, Addr addr) {
+            installed.push_back(addr);
+            return true;
+        });
+
+    EXPECT_EQ(3u, n);
+    EXPECT_EQ(0u, size);
+    EXPECT_TRUE(replay.empty());
+    EXPECT_EQ((std::vector<Addr>{0x0, 0x40, 0x80}), installed);
+}
+
+TEST(TraceInstallTest, DeclinedKeepOrder)
+{
+    // Controller 1 declines everything
+    auto trace = makeTrace({{0, 0x0}, {1, 0x40}, {0, 0x80}, {1, 0xc0}}, 1);
+    uint64_t size = trace.size();
+    std::vector<bool> replay;
+
+    uint64_t n = installTraceRecords(trace.data(), size, blockSize,
+        blockSize, replay,
+        [](const TraceRecord &rec, Addr addr) {
+            return rec.m_cntrl_id == 0;
+        });
+
+    EXPECT_EQ(2u, n);
+    ASSERT_EQ(2 * (sizeof(TraceRecord) + blockSize), size);
+    EXPECT_EQ(1, recordAt(trace, 1, 0).m_data[0]);
+    EXPECT_EQ(0x40u, recordAt(trace, 1, 0).m_data_address);
+    EXPECT_EQ(3, recordAt(trace, 1, 1).m_data[0]);
+    EXPECT_EQ(0xc0u, recordAt(trace, 1, 1).m_data_address);
+    EXPECT_EQ((std::vector<bool>{true, true}), replay);
+}
+
+TEST(TraceInstallTest, LaterRecordsForDeclinedLineKept)
+{
+    // The first record for 0x40 is declined, so the later one, which
+    // would be accepted, must be replayed after it rather than installed
+    // before it.
+    auto trace = makeTrace({{1, 0x40}, {0, 0x0}, {0, 0x40}}, 1);
+    uint64_t size = trace.size();
+    std::vector<bool> replay;
+    std::vector<Addr> offered;
+
+    uint64_t n = installTraceRecords(trace.data(), size, blockSize,
+        blockSize, replay,
+        [&](const TraceRecord &rec, Addr addr) {
+            offered.push_back(addr);
+            return rec.m_cntrl_id == 0;
+        });
+
+    EXPECT_EQ(1u, n);
+    EXPECT_EQ((std::vector<Addr>{0x40, 0x0}), offered);
+    ASSERT_EQ(2 * (sizeof(TraceRecord) + blockSize), size);
+    EXPECT_EQ(0, recordAt(trace, 1, 0).m_data[0]);
+    EXPECT_EQ(2, recordAt(trace, 1, 1).m_data[0]);
+    EXPECT_EQ((std::vector<bool>{true, true}), replay);
+}
+
+TEST(TraceInstallTest, PartialRecordReplaysDeclinedBlocks)
+{
+    // Records of four blocks, where the block at 0x140 is declined
+    auto trace = makeTrace({{0, 0x0}, {0, 0x100}}, 4);
+    uint64_t size = trace.size();
+    std::vector<bool> replay;
+
+    uint64_t n = installTraceRecords(trace.data(), size, 4 * blockSize,
+        blockSize, replay,
+        [](const TraceRecord &rec, Addr addr) {
+            return addr != 0x140;
+        });
+
+    EXPECT_EQ(1u, n);
+    ASSERT_EQ(sizeof(TraceRecord) + 4 * blockSize, size);
+    EXPECT_EQ(0x100u, recordAt(trace, 4, 0).m_data_address);
+    EXPECT_EQ((std::vector<bool>{false, true, false, false}), replay);
+}
@@ -159,19 +159,22 @@ VIPERCoalescer::issueRequest(CoalescedRequest* crequest)
     }
     std::shared_ptr<RubyRequest> msg;
     if (pkt->isAtomicOp()) {
-        msg = std::make_shared<RubyRequest>(clockEdge(), pkt->getAddr(),
-                              pkt->getSize(), pc, crequest->getRubyType(),
-                              RubyAccessMode_Supervisor, pkt,
-                              PrefetchBit_No, proc_id, 100,
-                              blockSize, accessMask,
-                              dataBlock, atomicOps, crequest->getSeqNum());
+        msg = RubyRequest::create(clockEdge(), pkt->getAddr(),
+                                  pkt->getSize(), pc,
+                                  crequest->getRubyType(),
+                                  RubyAccessMode_Supervisor, pkt,
+                                  PrefetchBit_No, proc_id, 100,
+                                  blockSize, accessMask,
+                                  dataBlock, atomicOps,
+                                  crequest->getSeqNum());
     } else {
-        msg = std::make_shared<RubyRequest>(clockEdge(), pkt->getAddr(),
-                              pkt->getSize(), pc, crequest->getRubyType(),
-                              RubyAccessMode_Supervisor, pkt,
-                              PrefetchBit_No, proc_id, 100,
-                              blockSize, accessMask,
-                              dataBlock, crequest->getSeqNum());
+        msg = RubyRequest::create(clockEdge(), pkt->getAddr(),
+                                  pkt->getSize(), pc,
+                                  crequest->getRubyType(),
+                                  RubyAccessMode_Supervisor, pkt,
+                                  PrefetchBit_No, proc_id, 100,
+                                  blockSize, accessMask,
+                                  dataBlock, crequest->getSeqNum());
     }
 
     if (pkt->cmd == MemCmd::WriteReq) {
@@ -295,7 +298,7 @@ VIPERCoalescer::invTCP()
         Addr addr = m_dataCache_ptr->getAddressAtIdx(i);
         // Evict Read-only data
         RubyRequestType request_type = RubyRequestType_REPLACEMENT;
-        std::shared_ptr<RubyRequest> msg = std::make_shared<RubyRequest>(
+        std::shared_ptr<RubyRequest> msg = RubyRequest::create(
             clockEdge(), addr, 0, 0,
             request_type, RubyAccessMode_Supervisor,
             nullptr);
@@ -342,7 +345,7 @@ VIPERCoalescer::invTCC(PacketPtr pkt)
     Addr addr = pkt->req->getPaddr();
     RubyRequestType request_type = RubyRequestType_InvL2;
 
-    std::shared_ptr<RubyRequest> msg = std::make_shared<RubyRequest>(
+    std::shared_ptr<RubyRequest> msg = RubyRequest::create(
         clockEdge(), addr, 0, 0,
         request_type, RubyAccessMode_Supervisor,
         nullptr);
@@ -79,6 +79,13 @@ def main(args=None):
         help="Path where C++ code output code goes",
     )
     parser.add_option("-H", "--html-path", help="Path where html output goes")
+    parser.add_option(
+        "-T",
+        "--transition-table",
+        default=False,
+        action="store_true",
+        help="Dispatch transitions through a constant table",
+    )
     parser.add_option(
         "-F",
         "--print-files",
@@ -118,6 +125,7 @@ def main(args=None):
         verbose=True,
         debug=opts.debug,
         traceback=opts.tb,
+        transition_table=opts.transition_table,
     )
 
     if opts.print_files:
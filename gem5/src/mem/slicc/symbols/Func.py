@@ -67,7 +67,14 @@ class Func(Symbol):
         elif "return_by_pointer" in self and self.return_type != void_type:
             return_type += "*"
 
-        return f"{return_type} {self.c_name}({', '.join(self.param_strings)});"
+        # Functions that implement a virtual of AbstractController are
+        # marked with override="yes"
+        override = " override" if "override" in self else ""
+
+        return (
+            f"{return_type} {self.c_name}({', '.join(self.param_strings)})"
+            f"{override};"
+        )
 
     def writeCodeFiles(self, path, includes):
         return
@@ -254,11 +254,15 @@ class StateMachine(Symbol):
                 in_msg_bufs[buf_name].append(port)
         return port_to_buf_map, in_msg_bufs, msg_bufs
 
+    @property
+    def transition_table(self):
+        return self.symtab.slicc.transition_table
+
     def writeCodeFiles(self, path, includes):
         self.printControllerPython(path)
         self.printControllerHH(path)
         self.printControllerCC(path, includes)
-        self.printCSwitch(path)
+        self.printCSwitch(path, includes)
         self.printCWakeup(path, includes)
 
     def printControllerPython(self, path):
@@ -1232,83 +1236,14 @@ $c_ident::recordCacheTrace(int cntrl, CacheRecorder* tr)
             """
 }
 
-// Actions
 """
         )
-        if self.TBEType != None and self.EntryType != None:
-            for action in self.actions.values():
-                if "c_code" not in action:
-                    continue
-
-                code(
-                    """
-/** \\brief ${{action.desc}} */
-void
-$c_ident::${{action.ident}}(${{self.TBEType.c_ident}}*& m_tbe_ptr, ${{self.EntryType.c_ident}}*& m_cache_entry_ptr, Addr addr)
-{
-    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
-    try {
-       ${{action["c_code"]}}
-    } catch (const RejectException & e) {
-       fatal("Error in action ${{ident}}:${{action.ident}}: "
-             "executed a peek statement with the wrong message "
-             "type specified. ");
-    }
-}
-
-"""
-                )
-        elif self.TBEType != None:
-            for action in self.actions.values():
-                if "c_code" not in action:
-                    continue
-
-                code(
-                    """
-/** \\brief ${{action.desc}} */
-void
-$c_ident::${{action.ident}}(${{self.TBEType.c_ident}}*& m_tbe_ptr, Addr addr)
-{
-    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
-    ${{action["c_code"]}}
-}
-
-"""
-                )
-        elif self.EntryType != None:
-            for action in self.actions.values():
-                if "c_code" not in action:
-                    continue
-
-                code(
-                    """
-/** \\brief ${{action.desc}} */
-void
-$c_ident::${{action.ident}}(${{self.EntryType.c_ident}}*& m_cache_entry_ptr, Addr addr)
-{
-    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
-    ${{action["c_code"]}}
-}
-
-"""
-                )
-        else:
-            for action in self.actions.values():
-                if "c_code" not in action:
-                    continue
-
-                code(
-                    """
-/** \\brief ${{action.desc}} */
-void
-$c_ident::${{action.ident}}(Addr addr)
-{
-    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
-    ${{action["c_code"]}}
-}
+        # With the transition table the actions are defined next to the
+        # dispatch code instead, so that they can be inlined into it.
+        if not self.transition_table:
+            code("// Actions")
+            self.printActions(code)
 
-"""
-                )
         for func in self.functions:
             code(func.generateCode())
 
@@ -1546,16 +1481,259 @@ ${ident}_Controller::wakeup()
 
         code.write(path, f"{self.ident}_Wakeup.cc")
 
-    def printCSwitch(self, path):
+    def printActions(self, code):
+        """Output the definitions of the actions"""
+
+        ident = self.ident
+        c_ident = f"{self.ident}_Controller"
+
+        if self.TBEType != None and self.EntryType != None:
+            for action in self.actions.values():
+                if "c_code" not in action:
+                    continue
+
+                code(
+                    """
+/** \\brief ${{action.desc}} */
+void
+$c_ident::${{action.ident}}(${{self.TBEType.c_ident}}*& m_tbe_ptr, ${{self.EntryType.c_ident}}*& m_cache_entry_ptr, Addr addr)
+{
+    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
+    try {
+       ${{action["c_code"]}}
+    } catch (const RejectException & e) {
+       fatal("Error in action ${{ident}}:${{action.ident}}: "
+             "executed a peek statement with the wrong message "
+             "type specified. ");
+    }
+}
+
+"""
+                )
+        elif self.TBEType != None:
+            for action in self.actions.values():
+                if "c_code" not in action:
+                    continue
+
+                code(
+                    """
+/** \\brief ${{action.desc}} */
+void
+$c_ident::${{action.ident}}(${{self.TBEType.c_ident}}*& m_tbe_ptr, Addr addr)
+{
+    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
+    ${{action["c_code"]}}
+}
+
+"""
+                )
+        elif self.EntryType != None:
+            for action in self.actions.values():
+                if "c_code" not in action:
+                    continue
+
+                code(
+                    """
+/** \\brief ${{action.desc}} */
+void
+$c_ident::${{action.ident}}(${{self.EntryType.c_ident}}*& m_cache_entry_ptr, Addr addr)
+{
+    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
+    ${{action["c_code"]}}
+}
+
+"""
+                )
+        else:
+            for action in self.actions.values():
+                if "c_code" not in action:
+                    continue
+
+                code(
+                    """
+/** \\brief ${{action.desc}} */
+void
+$c_ident::${{action.ident}}(Addr addr)
+{
+    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
+    ${{action["c_code"]}}
+}
+
+"""
+                )
+
+    def transitionCases(self):
+        """Return the unique code blocks of the transitions, each mapped
+        to the list of (state, event) pairs that it handles"""
+
+        ident = self.ident
+
+        # This map will allow suppress generating duplicate code
+        cases = OrderedDict()
+
+        for trans in self.transitions:
+            case_string = "{}_State_{}, {}_Event_{}".format(
+                self.ident,
+                trans.state.ident,
+                self.ident,
+                trans.event.ident,
+            )
+
+            case = self.symtab.codeFormatter()
+            # Only set next_state if it changes
+            if trans.state != trans.nextState:
+                if trans.nextState.isWildcard():
+                    # When * is encountered as an end state of a transition,
+                    # the next state is determined by calling the
+                    # machine-specific getNextState function. The next state
+                    # is determined before any actions of the transition
+                    # execute, and therefore the next state calculation cannot
+                    # depend on any of the transitionactions.
+                    case(
+                        "next_state = getNextState(addr); "
+                        "m_curTransitionNextState = next_state;"
+                    )
+                else:
+                    ns_ident = trans.nextState.ident
+                    case(
+                        "next_state = ${ident}_State_${ns_ident}; "
+                        "m_curTransitionNextState = next_state;"
+                    )
+
+            actions = trans.actions
+            request_types = trans.request_types
+
+            # Check for resources
+            case_sorter = []
+            res = trans.resources
+            for key, val in res.items():
+                val = f"""
+if (!{key.code}.areNSlotsAvailable({val}, clockEdge()))
+    return TransitionResult_ResourceStall;
+"""
+                case_sorter.append(val)
+
+            # Check all of the request_types for resource constraints
+            for request_type in request_types:
+                val = """
+if (!checkResourceAvailable({}_RequestType_{}, addr)) {{
+    return TransitionResult_ResourceStall;
+}}
+""".format(
+                    self.ident,
+                    request_type.ident,
+                )
+                case_sorter.append(val)
+
+            # Emit the code sequences in a sorted order.  This makes the
+            # output deterministic (without this the output order can vary
+            # since Map's keys() on a vector of pointers is not deterministic
+            for c in sorted(case_sorter):
+                case("$c")
+
+            # Record access types for this transition
+            for request_type in request_types:
+                case(
+                    "recordRequestType(${ident}_RequestType_${{request_type.ident}}, addr);"
+                )
+
+            # Figure out if we stall
+            stall = False
+            for action in actions:
+                if action.ident == "z_stall":
+                    stall = True
+                    break
+
+            if stall:
+                case("return TransitionResult_ProtocolStall;")
+            else:
+                if self.TBEType != None and self.EntryType != None:
+                    for action in actions:
+                        case(
+                            "${{action.ident}}(m_tbe_ptr, m_cache_entry_ptr, addr);"
+                        )
+                elif self.TBEType != None:
+                    for action in actions:
+                        case("${{action.ident}}(m_tbe_ptr, addr);")
+                elif self.EntryType != None:
+                    for action in actions:
+                        case("${{action.ident}}(m_cache_entry_ptr, addr);")
+                else:
+                    for action in actions:
+                        case("${{action.ident}}(addr);")
+                case("return TransitionResult_Valid;")
+
+            case = str(case)
+
+            # Look to see if this transition code is unique.
+            if case not in cases:
+                cases[case] = []
+
+            cases[case].append(case_string)
+
+        return cases
+
+    def printCSwitch(self, path, includes):
         """Output switch statement for transition table"""
 
         code = self.symtab.codeFormatter()
         ident = self.ident
+        cases = self.transitionCases()
 
         code(
             """
 // ${ident}: ${{self.short}}
 
+"""
+        )
+        if self.transition_table:
+            # The actions are defined in this file, so it needs everything
+            # the controller itself includes.
+            code(
+                """
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+
+#include "mem/ruby/common/BoolVec.hh"
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+"""
+            )
+            flags = self.debug_flags | {"ProtocolTrace", "RubyGenerated"}
+            for f in sorted(flags):
+                code('#include "debug/${{f}}.hh"')
+            code(
+                """
+#include "mem/ruby/network/Network.hh"
+#include "mem/ruby/protocol/${ident}_Controller.hh"
+#include "mem/ruby/protocol/${ident}_Event.hh"
+#include "mem/ruby/protocol/${ident}_State.hh"
+#include "mem/ruby/protocol/Types.hh"
+#include "mem/ruby/system/RubySystem.hh"
+
+"""
+            )
+            for include_path in includes:
+                code('#include "${{include_path}}"')
+
+            seen_types = set()
+            for var in self.objects:
+                if (
+                    var.type.ident not in seen_types
+                    and not var.type.isPrimitive
+                ):
+                    code(
+                        '#include "mem/ruby/protocol/${{var.type.c_ident}}.hh"'
+                    )
+                seen_types.add(var.type.ident)
+        else:
+            code(
+                """
 #include <cassert>
 
 #include "base/logging.hh"
@@ -1567,18 +1745,78 @@ ${ident}_Controller::wakeup()
 #include "mem/ruby/protocol/${ident}_State.hh"
 #include "mem/ruby/protocol/Types.hh"
 #include "mem/ruby/system/RubySystem.hh"
+"""
+            )
 
+        code()
+        code(
+            """
 #define HASH_FUN(state, event)  ((int(state)*${ident}_Event_NUM)+int(event))
 
 #define GET_TRANSITION_COMMENT() (${ident}_transitionComment.str())
+#ifndef NDEBUG
 #define CLEAR_TRANSITION_COMMENT() (${ident}_transitionComment.str(""))
+#else
+#define CLEAR_TRANSITION_COMMENT() do {} while (0)
+#endif
+"""
+        )
+        code()
+        if self.transition_table:
+            code(
+                """
+#ifndef NDEBUG
+#define APPEND_TRANSITION_COMMENT(str) (${ident}_transitionComment << str)
+#else
+#define APPEND_TRANSITION_COMMENT(str) do {} while (0)
+#endif
+"""
+            )
+            code()
 
+        code(
+            """
 namespace gem5
 {
 
 namespace ruby
 {
+"""
+        )
+        code()
+        if self.transition_table:
+            assert len(cases) < 2**16
+            code(
+                """
+namespace
+{
 
+// Index of the case of doTransitionWorker handling each (state, event)
+// pair, where 0 marks an invalid transition.
+constexpr auto ${ident}_transitionTable = [] {
+    std::array<uint16_t, ${ident}_State_NUM * ${ident}_Event_NUM> table{};
+"""
+            )
+            code.indent()
+            for index, transitions in enumerate(cases.values(), 1):
+                for trans in transitions:
+                    code("table[HASH_FUN($trans)] = $index;")
+            code.dedent()
+            code(
+                """
+    return table;
+}();
+
+} // anonymous namespace
+
+// Actions
+"""
+            )
+            self.printActions(code)
+            code()
+
+        code(
+            """
 TransitionResult
 ${ident}_Controller::doTransition(${ident}_Event event,
 """
@@ -1725,121 +1963,28 @@ ${ident}_Controller::doTransitionWorker(${ident}_Event event,
 {
     m_curTransitionEvent = event;
     m_curTransitionNextState = next_state;
-    switch(HASH_FUN(state, event)) {
 """
         )
 
-        # This map will allow suppress generating duplicate code
-        cases = OrderedDict()
-
-        for trans in self.transitions:
-            case_string = "{}_State_{}, {}_Event_{}".format(
-                self.ident,
-                trans.state.ident,
-                self.ident,
-                trans.event.ident,
+        if self.transition_table:
+            code(
+                "    switch (${ident}_transitionTable[HASH_FUN(state, event)]) {"
             )
-
-            case = self.symtab.codeFormatter()
-            # Only set next_state if it changes
-            if trans.state != trans.nextState:
-                if trans.nextState.isWildcard():
-                    # When * is encountered as an end state of a transition,
-                    # the next state is determined by calling the
-                    # machine-specific getNextState function. The next state
-                    # is determined before any actions of the transition
-                    # execute, and therefore the next state calculation cannot
-                    # depend on any of the transitionactions.
-                    case(
-                        "next_state = getNextState(addr); "
-                        "m_curTransitionNextState = next_state;"
-                    )
-                else:
-                    ns_ident = trans.nextState.ident
-                    case(
-                        "next_state = ${ident}_State_${ns_ident}; "
-                        "m_curTransitionNextState = next_state;"
-                    )
-
-            actions = trans.actions
-            request_types = trans.request_types
-
-            # Check for resources
-            case_sorter = []
-            res = trans.resources
-            for key, val in res.items():
-                val = f"""
-if (!{key.code}.areNSlotsAvailable({val}, clockEdge()))
-    return TransitionResult_ResourceStall;
-"""
-                case_sorter.append(val)
-
-            # Check all of the request_types for resource constraints
-            for request_type in request_types:
-                val = """
-if (!checkResourceAvailable({}_RequestType_{}, addr)) {{
-    return TransitionResult_ResourceStall;
-}}
-""".format(
-                    self.ident,
-                    request_type.ident,
-                )
-                case_sorter.append(val)
-
-            # Emit the code sequences in a sorted order.  This makes the
-            # output deterministic (without this the output order can vary
-            # since Map's keys() on a vector of pointers is not deterministic
-            for c in sorted(case_sorter):
-                case("$c")
-
-            # Record access types for this transition
-            for request_type in request_types:
-                case(
-                    "recordRequestType(${ident}_RequestType_${{request_type.ident}}, addr);"
-                )
-
-            # Figure out if we stall
-            stall = False
-            for action in actions:
-                if action.ident == "z_stall":
-                    stall = True
-                    break
-
-            if stall:
-                case("return TransitionResult_ProtocolStall;")
-            else:
-                if self.TBEType != None and self.EntryType != None:
-                    for action in actions:
-                        case(
-                            "${{action.ident}}(m_tbe_ptr, m_cache_entry_ptr, addr);"
-                        )
-                elif self.TBEType != None:
-                    for action in actions:
-                        case("${{action.ident}}(m_tbe_ptr, addr);")
-                elif self.EntryType != None:
-                    for action in actions:
-                        case("${{action.ident}}(m_cache_entry_ptr, addr);")
-                else:
-                    for action in actions:
-                        case("${{action.ident}}(addr);")
-                case("return TransitionResult_Valid;")
-
-            case = str(case)
-
-            # Look to see if this transition code is unique.
-            if case not in cases:
-                cases[case] = []
-
-            cases[case].append(case_string)
-
-        # Walk through all of the unique code blocks and spit out the
-        # corresponding case statement elements
-        for case, transitions in cases.items():
-            # Iterative over all the multiple transitions that share
-            # the same code
-            for trans in transitions:
-                code("  case HASH_FUN($trans):")
-            code("    $case\n")
+            for index, (case, transitions) in enumerate(cases.items(), 1):
+                for trans in transitions:
+                    code("  // $trans")
+                code("  case $index:")
+                code("    $case\n")
+        else:
+            code("    switch(HASH_FUN(state, event)) {")
+            # Walk through all of the unique code blocks and spit out the
+            # corresponding case statement elements
+            for case, transitions in cases.items():
+                # Iterative over all the multiple transitions that share
+                # the same code
+                for trans in transitions:
+                    code("  case HASH_FUN($trans):")
+                code("    $case\n")
 
         code(
             """
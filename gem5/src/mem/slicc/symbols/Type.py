@@ -326,7 +326,17 @@ $klass ${{self.c_ident}}$parent
 MsgPtr
 clone() const
 {
-     return std::shared_ptr<Message>(new ${{self.c_ident}}(*this));
+     return create(*this);
+}
+
+/** Allocate a ${{self.c_ident}} from the free list of this type. */
+template <typename... Args>
+static std::shared_ptr<${{self.c_ident}}>
+create(Args&&... args)
+{
+     return std::allocate_shared<${{self.c_ident}}>(
+         MessagePoolAllocator<${{self.c_ident}}>(),
+         std::forward<Args>(args)...);
 }
 """
             )
@@ -27,6 +27,7 @@
 
 #include "mem/thread_bridge.hh"
 
+#include "base/logging.hh"
 #include "base/trace.hh"
 #include "sim/eventq.hh"
 
@@ -34,8 +35,152 @@ namespace gem5
 {
 
 ThreadBridge::ThreadBridge(const ThreadBridgeParams &p)
-    : SimObject(p), in_port_("in_port", *this), out_port_("out_port", *this)
+    : SimObject(p), in_port_("in_port", *this), out_port_("out_port", *this),
+      delay_(p.delay), inQueue_(getEventQueue(p.in_eventq_index)),
+      reqLimit_(p.req_size), outstandingReqs_(0), retryReq_(false),
+      retryReqEvent_([this]{ in_port_.sendRetryReq(); },
+                     name() + ".retry_req_event"),
+      inFlight_(0), stats(this)
 {
+    fatal_if(reqLimit_ == 0, "%s: req_size must be at least 1.", name());
+}
+
+ThreadBridge::ThreadBridgeStats::ThreadBridgeStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(requests, statistics::units::Count::get(),
+               "Number of timing requests sent across the bridge"),
+      ADD_STAT(responses, statistics::units::Count::get(),
+               "Number of timing responses sent across the bridge"),
+      ADD_STAT(snoops, statistics::units::Count::get(),
+               "Number of timing snoop requests sent across the bridge"),
+      ADD_STAT(refused, statistics::units::Count::get(),
+               "Number of packets refused by their receiver and queued "
+               "in the bridge")
+{
+}
+
+void
+ThreadBridge::startup()
+{
+    // A packet sent at the very end of a quantum must not land in the
+    // past of a queue that is allowed to run ahead until the next
+    // synchronisation point.
+    fatal_if(inQueue_ != eventQueue() && delay_ < simQuantum,
+             "%s: delay (%d) must be at least the simulation quantum (%d).",
+             name(), delay_, simQuantum);
+}
+
+DrainState
+ThreadBridge::drain()
+{
+    return inFlight_ ? DrainState::Draining : DrainState::Drained;
+}
+
+void
+ThreadBridge::forward(PacketPtr pkt, DeliverEvent::Kind kind,
+                      EventQueue *eq)
+{
+    panic_if(delay_ == 0,
+             "%s: timing accesses need a non-zero delay.", name());
+    inFlight_++;
+    // When the target queue belongs to another thread this ends up as
+    // an asynchronous insertion that is picked up at the next quantum
+    // boundary, which is why the delay must cover a whole quantum.
+    eq->schedule(new DeliverEvent(*this, pkt, kind), curTick() + delay_);
+}
+
+void
+ThreadBridge::deliverReq(PacketPtr pkt)
+{
+    // The target owns the packet once it has accepted it
+    bool needs_response = pkt->needsResponse();
+    if (!reqQueue_.empty() || !out_port_.sendTimingReq(pkt)) {
+        stats.refused++;
+        reqQueue_.push_back(pkt);
+        return;
+    }
+    reqSent(needs_response);
+}
+
+void
+ThreadBridge::deliverResp(PacketPtr pkt)
+{
+    if (!respQueue_.empty() || !in_port_.sendTimingResp(pkt)) {
+        stats.refused++;
+        respQueue_.push_back(pkt);
+        return;
+    }
+    releaseReq();
+    retire();
+}
+
+void
+ThreadBridge::reqSent(bool needs_response)
+{
+    if (!needs_response)
+        forward(nullptr, DeliverEvent::Credit, inQueue_);
+    retire();
+}
+
+void
+ThreadBridge::releaseReq()
+{
+    assert(outstandingReqs_ > 0);
+    outstandingReqs_--;
+    if (retryReq_ && !retryReqEvent_.scheduled()) {
+        retryReq_ = false;
+        inQueue_->schedule(&retryReqEvent_, curTick());
+    }
+}
+
+void
+ThreadBridge::retire()
+{
+    if (--inFlight_ == 0 && drainState() == DrainState::Draining)
+        signalDrainDone();
+}
+
+ThreadBridge::DeliverEvent::DeliverEvent(ThreadBridge &device,
+                                         PacketPtr pkt, Kind kind)
+    : Event(Default_Pri, AutoDelete), device_(device), pkt_(pkt),
+      kind_(kind)
+{
+}
+
+void
+ThreadBridge::DeliverEvent::process()
+{
+    switch (kind_) {
+      case Request:
+        device_.deliverReq(pkt_);
+        break;
+      case Response:
+        device_.deliverResp(pkt_);
+        break;
+      case SnoopRequest:
+        // Snoops are only passed on as a notification; the copy made
+        // when the snoop crossed the bridge is ours to free.
+        device_.in_port_.sendTimingSnoopReq(pkt_);
+        delete pkt_;
+        device_.retire();
+        break;
+      case Credit:
+        device_.releaseReq();
+        device_.retire();
+        break;
+    }
+}
+
+const char *
+ThreadBridge::DeliverEvent::description() const
+{
+    return "ThreadBridge delivery";
+}
+
+const std::string
+ThreadBridge::DeliverEvent::name() const
+{
+    return device_.name() + ".deliver_event";
 }
 
 ThreadBridge::IncomingPort::IncomingPort(const std::string &name,
@@ -54,12 +199,29 @@ ThreadBridge::IncomingPort::getAddrRanges() const
 bool
 ThreadBridge::IncomingPort::recvTimingReq(PacketPtr pkt)
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    if (device_.outstandingReqs_ >= device_.reqLimit_) {
+        device_.retryReq_ = true;
+        return false;
+    }
+    device_.outstandingReqs_++;
+    device_.stats.requests++;
+    device_.forward(pkt, DeliverEvent::Request, device_.eventQueue());
+    return true;
 }
 void
 ThreadBridge::IncomingPort::recvRespRetry()
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    auto &queue = device_.respQueue_;
+    while (!queue.empty() && device_.in_port_.sendTimingResp(queue.front())) {
+        queue.pop_front();
+        device_.releaseReq();
+        device_.retire();
+    }
+}
+bool
+ThreadBridge::IncomingPort::recvTimingSnoopResp(PacketPtr pkt)
+{
+    panic("ThreadBridge does not support timing snoop responses.");
 }
 
 // AtomicResponseProtocol
@@ -90,16 +252,62 @@ ThreadBridge::OutgoingPort::recvRangeChange()
     device_.in_port_.sendRangeChange();
 }
 
+bool
+ThreadBridge::OutgoingPort::isSnooping() const
+{
+    return device_.in_port_.isSnooping();
+}
+
 // TimingRequestProtocol
 bool
 ThreadBridge::OutgoingPort::recvTimingResp(PacketPtr pkt)
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    device_.stats.responses++;
+    device_.forward(pkt, DeliverEvent::Response, device_.inQueue_);
+    return true;
 }
 void
 ThreadBridge::OutgoingPort::recvReqRetry()
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    auto &queue = device_.reqQueue_;
+    while (!queue.empty()) {
+        bool needs_response = queue.front()->needsResponse();
+        if (!device_.out_port_.sendTimingReq(queue.front()))
+            break;
+        queue.pop_front();
+        device_.reqSent(needs_response);
+    }
+}
+void
+ThreadBridge::OutgoingPort::recvTimingSnoopReq(PacketPtr pkt)
+{
+    // The snooped packet belongs to the sender and will be long gone
+    // by the time the copy reaches the other side. Snoopers across a
+    // bridge only get to observe the snoop, they can't respond to it.
+    device_.stats.snoops++;
+    device_.forward(new Packet(pkt, false, false),
+                    DeliverEvent::SnoopRequest, device_.inQueue_);
+}
+void
+ThreadBridge::OutgoingPort::recvRetrySnoopResp()
+{
+    panic("ThreadBridge does not support timing snoop responses.");
+}
+
+// AtomicRequestProtocol
+Tick
+ThreadBridge::OutgoingPort::recvAtomicSnoop(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(device_.inQueue_);
+    return device_.in_port_.sendAtomicSnoop(pkt);
+}
+
+// FunctionalRequestProtocol
+void
+ThreadBridge::OutgoingPort::recvFunctionalSnoop(PacketPtr pkt)
+{
+    EventQueue::ScopedMigration migrate(device_.inQueue_);
+    device_.in_port_.sendFunctionalSnoop(pkt);
 }
 
 Port &
@@ -28,8 +28,13 @@
 #ifndef __MEM_THREAD_BRIDGE_HH__
 #define __MEM_THREAD_BRIDGE_HH__
 
+#include <atomic>
+#include <deque>
+
+#include "base/statistics.hh"
 #include "mem/port.hh"
 #include "params/ThreadBridge.hh"
+#include "sim/eventq.hh"
 #include "sim/sim_object.hh"
 
 namespace gem5
@@ -43,6 +48,10 @@ class ThreadBridge : public SimObject
     Port &getPort(const std::string &if_name,
                   PortID idx = InvalidPortID) override;
 
+    void startup() override;
+
+    DrainState drain() override;
+
   private:
     class IncomingPort : public ResponsePort
     {
@@ -54,6 +63,8 @@ class ThreadBridge : public SimObject
         bool recvTimingReq(PacketPtr pkt) override;
         void recvRespRetry() override;
 
+        bool recvTimingSnoopResp(PacketPtr pkt) override;
+
         // AtomicResponseProtocol
         Tick recvAtomic(PacketPtr pkt) override;
 
@@ -69,17 +80,123 @@ class ThreadBridge : public SimObject
       public:
         OutgoingPort(const std::string &name, ThreadBridge &device);
         void recvRangeChange() override;
+        bool isSnooping() const override;
 
         // TimingRequestProtocol
         bool recvTimingResp(PacketPtr pkt) override;
         void recvReqRetry() override;
+        void recvTimingSnoopReq(PacketPtr pkt) override;
+        void recvRetrySnoopResp() override;
+
+        // AtomicRequestProtocol
+        Tick recvAtomicSnoop(PacketPtr pkt) override;
+
+        // FunctionalRequestProtocol
+        void recvFunctionalSnoop(PacketPtr pkt) override;
+
+      private:
+        ThreadBridge &device_;
+    };
+
+    /**
+     * Event carrying a single timing packet across the bridge. It is
+     * scheduled on the event queue of the side the packet is headed
+     * to, possibly from another thread, and deletes itself once it
+     * has been serviced.
+     */
+    class DeliverEvent : public Event
+    {
+      public:
+        enum Kind
+        {
+            Request,
+            Response,
+            SnoopRequest,
+            /** A request slot was freed on the target side. */
+            Credit
+        };
+
+        DeliverEvent(ThreadBridge &device, PacketPtr pkt, Kind kind);
+
+        void process() override;
+        const char *description() const override;
+        const std::string name() const override;
 
       private:
         ThreadBridge &device_;
+        PacketPtr pkt_;
+        Kind kind_;
     };
 
+    /**
+     * Hand a timing packet over to the other side of the bridge,
+     * delay ticks from now.
+     */
+    void forward(PacketPtr pkt, DeliverEvent::Kind kind, EventQueue *eq);
+
+    /** Send (or queue) a packet that has arrived on its own side. */
+    void deliverReq(PacketPtr pkt);
+    void deliverResp(PacketPtr pkt);
+
+    /**
+     * A request has been accepted on the target side. Requests that
+     * don't expect a response free their slot here, the others free it
+     * when their response is accepted by the initiator.
+     */
+    void reqSent(bool needs_response);
+
+    /** Free a request slot on the initiator side. */
+    void releaseReq();
+
+    /** A packet has left the bridge, check whether we are drained. */
+    void retire();
+
     IncomingPort in_port_;
     OutgoingPort out_port_;
+
+    /** Latency of a timing packet crossing the bridge. */
+    const Tick delay_;
+
+    /** Event queue the initiator (in_port_ side) runs on. */
+    EventQueue *const inQueue_;
+
+    /**
+     * Maximum number of timing requests the bridge accepts before the
+     * initiator has to wait for a retry. A request holds its slot until
+     * its response has been accepted by the initiator, so this bounds
+     * both the request and the response buffers. The counters are only
+     * touched by the initiator's thread; the target side hands freed
+     * slots back with a Credit event.
+     */
+    const unsigned reqLimit_;
+    unsigned outstandingReqs_;
+    bool retryReq_;
+    EventFunctionWrapper retryReqEvent_;
+
+    /**
+     * Packets that have crossed the bridge but were refused by the
+     * receiver. Each queue is only touched by the thread on the side
+     * it sends from.
+     */
+    std::deque<PacketPtr> reqQueue_;
+    std::deque<PacketPtr> respQueue_;
+
+    /** Number of timing packets currently owned by the bridge. */
+    std::atomic<unsigned> inFlight_;
+
+    /**
+     * The two sides of the bridge run on different threads, so these
+     * use sharded stats that each thread updates without locking.
+     */
+    struct ThreadBridgeStats : public statistics::Group
+    {
+        ThreadBridgeStats(statistics::Group *parent);
+
+        statistics::ShardedScalar requests;
+        statistics::ShardedScalar responses;
+        statistics::ShardedScalar snoops;
+        statistics::ShardedScalar refused;
+    } stats;
 };
 
 }  // namespace gem5
@@ -0,0 +1,188 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Spread the cores of a stdlib board over multiple event queues, and thereby
+multiple host threads.
+
+gem5 can run each main event queue on its own host thread, synchronising the
+queues every ``sim_quantum`` ticks. Doing so by hand means assigning an
+``eventq_index`` to every SimObject, making sure nothing talks across queues
+without a ``ThreadBridge`` and picking a quantum that no bridge undercuts.
+The ``EventQueuePartitioner`` does this for a board whose connections have
+been made (i.e., after ``AbstractBoard._pre_instantiate``):
+
+* Each core, together with everything below it in the SimObject tree (ISA,
+  MMU, interrupt controller, branch predictor, ...), is moved to an event
+  queue of its own. Queue 0 keeps everything else.
+* Every port connecting a core's subtree to the rest of the board is
+  spliced with a ``ThreadBridge``.
+* Each bridge delays timing packets by the latency of the component on the
+  far side of it (the ``response_latency`` of a cache or crossbar, one board
+  clock cycle otherwise) and the smallest such latency becomes the
+  simulation quantum. As that is usually about one cycle, the threads
+  synchronise at a barrier about every cycle.
+
+The cache hierarchy stays on queue 0: classic caches keep each other
+coherent with snoops that must complete instantly, and Ruby runs as one
+system, so neither can be split without changing the protocol. The bridges
+add their delay to every access that crosses them.
+"""
+
+from typing import (
+    List,
+    Optional,
+)
+
+import m5
+from m5.objects import (
+    Root,
+    ThreadBridge,
+)
+from m5.params import VectorPortRef
+from m5.proxy import isproxy
+from m5.util import (
+    fatal,
+    inform,
+    warn,
+)
+
+from ..components.boards.abstract_board import AbstractBoard
+from ..components.processors.switchable_processor import SwitchableProcessor
+
+
+class EventQueuePartitioner:
+    """
+    Places the cores of a board on separate event queues.
+    """
+
+    def __init__(self, num_threads: Optional[int] = None) -> None:
+        """
+        :param num_threads: The number of event queues to spread the cores
+                            over, in addition to the queue the rest of the
+                            board runs on. Cores are assigned to queues in
+                            contiguous groups. By default every core gets a
+                            queue of its own.
+        """
+        if num_threads is not None and num_threads < 1:
+            fatal("EventQueuePartitioner needs at least one thread.")
+        self._num_threads = num_threads
+
+    def partition(self, board: AbstractBoard, root: Root) -> None:
+        """
+        Partition the board and set the simulation quantum on ``root``.
+
+        :param board: The board to partition. Its connections must already
+                      have been made.
+        :param root: The root of the simulation.
+        """
+        processor = board.get_processor()
+        cores = processor.get_cores()
+
+        if isinstance(processor, SwitchableProcessor):
+            warn(
+                "Not partitioning the event queues of a board with a "
+                "SwitchableProcessor."
+            )
+            return
+        if any(core.is_kvm_core() for core in cores):
+            # KVM processors already put each core on a queue of its own.
+            return
+
+        num_threads = min(self._num_threads or len(cores), len(cores))
+
+        # The quantum and bridge delays are in ticks, which needs a fixed
+        # tick frequency.
+        m5.ticks.fixGlobalFrequency()
+        period = board.get_clock_domain().clock[0].getValue()
+
+        bridges = []
+        for i, core in enumerate(cores):
+            eventq_index = 1 + i * num_threads // len(cores)
+            bridges += self._partition_core(
+                core.get_simobject(), eventq_index, period
+            )
+
+        if not bridges:
+            return
+
+        board.event_queue_bridges = bridges
+        root.sim_quantum = min(int(bridge.delay) for bridge in bridges)
+        inform(
+            f"Partitioned {len(cores)} cores over {num_threads} event "
+            f"queues with {len(bridges)} bridges, quantum "
+            f"{int(root.sim_quantum)} ticks."
+        )
+
+    def _partition_core(
+        self, cpu: "BaseCPU", eventq_index: int, period: int
+    ) -> List[ThreadBridge]:
+        subtree = list(cpu.descendants())
+        members = set(id(obj) for obj in subtree)
+
+        for obj in subtree:
+            obj.eventq_index = eventq_index
+
+        bridges = []
+        for obj in subtree:
+            for ref in list(obj._port_refs.values()):
+                elements = (
+                    ref.elements if isinstance(ref, VectorPortRef) else [ref]
+                )
+                for port in elements:
+                    peer = port.peer
+                    if not peer or isproxy(peer):
+                        continue
+                    if id(peer.simobj) in members:
+                        continue
+
+                    # The bridge runs on the queue of the side it sends
+                    # requests to.
+                    if port.is_source:
+                        bridge = ThreadBridge(
+                            eventq_index=0, in_eventq_index=eventq_index
+                        )
+                    else:
+                        bridge = ThreadBridge(
+                            eventq_index=eventq_index, in_eventq_index=0
+                        )
+                    bridge.delay = f"{self._latency(peer.simobj, period)}t"
+                    port.splice(bridge.in_port, bridge.out_port)
+                    bridges.append(bridge)
+
+        return bridges
+
+    def _latency(self, obj: "SimObject", period: int) -> int:
+        # The bridge delay is added on top of the timing of the far side,
+        # in each direction. Using the response latency of a cache or
+        # crossbar keeps that extra delay to a cycle or so, the least a
+        # bridge can add. This delay is also the quantum, so the threads
+        # meet at a barrier about every cycle.
+        try:
+            cycles = int(obj.response_latency)
+        except AttributeError:
+            cycles = 1
+        return max(cycles, 1) * period
@@ -47,6 +47,7 @@ from m5.util import warn
 
 from ..components.boards.abstract_board import AbstractBoard
 from ..components.processors.switchable_processor import SwitchableProcessor
+from .event_queue_partitioner import EventQueuePartitioner
 from .exit_event import ExitEvent
 from .exit_event_generators import (
     dump_stats_generator,
@@ -109,6 +110,7 @@ class Simulator:
         checkpoint_path: Optional[Path] = None,
         max_ticks: Optional[int] = m5.MaxTick,
         id: Optional[int] = None,
+        partitioner: Optional[EventQueuePartitioner] = None,
     ) -> None:
         """
         :param board: The board to be simulated.
@@ -158,6 +160,10 @@ class Simulator:
         Simulator configuration. Note, the latter means the ID only available
         after the Simulator has been instantiated. The ID can be obtained via
         the `get_id` method.
+        :param partitioner: An optional ``EventQueuePartitioner`` used to run
+                            the board's cores on separate host threads. If
+                            not set, the whole board runs on a single event
+                            queue.
 
 
         ``on_exit_event`` usage notes
@@ -390,6 +396,7 @@ class Simulator:
             )
 
         self._checkpoint_path = checkpoint_path
+        self._partitioner = partitioner
 
     def set_id(self, id: str) -> None:
         """Set the ID of the simulator.
@@ -676,6 +683,9 @@ class Simulator:
                 m5.ticks.fixGlobalFrequency()
                 root.sim_quantum = m5.ticks.fromSeconds(0.001)
 
+            if self._partitioner:
+                self._partitioner.partition(self._board, root)
+
             # m5.instantiate() takes a parameter specifying the path to the
             # checkpoint directory. If the parameter is None, no checkpoint
             # will be restored.
@@ -0,0 +1,313 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Pick SimPoints from the basic block vectors (BBVs) recorded by the SimPoint
+probe (``BaseCPU.addSimPointProbe``), following the approach of the SimPoint
+3.2 tool:
+
+1. Each BBV is normalised and randomly projected down to a few dimensions.
+2. The projected vectors are clustered with k-means for a range of k.
+3. The smallest k whose Bayesian Information Criterion (BIC) score gets
+   within a threshold of the best score seen is chosen.
+4. From each cluster, the interval closest to its centroid is the SimPoint,
+   weighted by the fraction of all intervals in its cluster.
+
+This module doesn't depend on gem5 and can also be used from the command
+line, writing files in the format ``SimpointDirectoryResource`` reads:
+
+```
+python3 bbv_clustering.py m5out/simpoint.bb.gz \\
+    --simpoints simpoints.txt --weights weights.txt
+```
+"""
+
+import argparse
+import gzip
+import math
+import random
+from typing import (
+    Dict,
+    List,
+    Sequence,
+    Tuple,
+)
+
+Vector = List[float]
+
+
+def read_bbv(path: str) -> List[Dict[int, int]]:
+    """
+    Read a BBV file as written by the SimPoint probe. Each line starting
+    with ``T`` holds one interval as ``:<basic block>:<count>`` pairs.
+
+    :param path: The BBV file, optionally gzip compressed (``.gz``).
+    :returns: One dictionary mapping basic block ids to instruction counts
+              per interval.
+    """
+    opener = gzip.open if path.endswith(".gz") else open
+    bbvs = []
+    with opener(path, "rt") as f:
+        for line in f:
+            if not line.startswith("T"):
+                continue
+            bbv = {}
+            for pair in line[1:].split():
+                _, bb, count = pair.split(":")
+                bbv[int(bb)] = int(count)
+            bbvs.append(bbv)
+    return bbvs
+
+
+def project(
+    bbvs: Sequence[Dict[int, int]], dims: int = 15, seed: int = 1
+) -> List[Vector]:
+    """
+    Normalise each BBV to sum to one and project it onto ``dims`` random
+    dimensions. The projection of a basic block only depends on its id and
+    the seed, so the result doesn't depend on the order blocks are seen in.
+    """
+    projections = {}
+
+    def projection(bb: int) -> Vector:
+        if bb not in projections:
+            rng = random.Random(seed * 1000003 + bb)
+            projections[bb] = [rng.uniform(-1, 1) for _ in range(dims)]
+        return projections[bb]
+
+    vectors = []
+    for bbv in bbvs:
+        total = sum(bbv.values())
+        vector = [0.0] * dims
+        for bb, count in bbv.items():
+            weight = count / total
+            for d, r in enumerate(projection(bb)):
+                vector[d] += weight * r
+        vectors.append(vector)
+    return vectors
+
+
+def _distance(a: Vector, b: Vector) -> float:
+    return sum((x - y) * (x - y) for x, y in zip(a, b))
+
+
+def _closest(point: Vector, centroids: Sequence[Vector]) -> Tuple[int, float]:
+    best = 0
+    best_dist = math.inf
+    for i, centroid in enumerate(centroids):
+        dist = _distance(point, centroid)
+        if dist < best_dist:
+            best, best_dist = i, dist
+    return best, best_dist
+
+
+def kmeans(
+    points: Sequence[Vector],
+    k: int,
+    rng: random.Random,
+    max_iterations: int = 100,
+) -> Tuple[List[int], List[Vector], float]:
+    """
+    Cluster points with Lloyd's algorithm, seeded with k-means++.
+
+    :returns: The cluster of each point, the centroids and the distortion
+              (sum of squared distances of the points to their centroids).
+    """
+    centroids = [list(rng.choice(points))]
+    dists = [_distance(p, centroids[0]) for p in points]
+    while len(centroids) < k:
+        total = sum(dists)
+        if total == 0:
+            break
+        target = rng.uniform(0, total)
+        for i, dist in enumerate(dists):
+            target -= dist
+            if target <= 0:
+                break
+        centroids.append(list(points[i]))
+        dists = [
+            min(d, _distance(p, points[i])) for d, p in zip(dists, points)
+        ]
+
+    labels = [-1] * len(points)
+    for _ in range(max_iterations):
+        changed = False
+        for i, point in enumerate(points):
+            label, _ = _closest(point, centroids)
+            if label != labels[i]:
+                labels[i] = label
+                changed = True
+        if not changed:
+            break
+
+        sums = [[0.0] * len(points[0]) for _ in centroids]
+        counts = [0] * len(centroids)
+        for point, label in zip(points, labels):
+            counts[label] += 1
+            for d, x in enumerate(point):
+                sums[label][d] += x
+        for c, count in enumerate(counts):
+            # Keep the old centroid for clusters that became empty.
+            if count:
+                centroids[c] = [x / count for x in sums[c]]
+
+    distortion = sum(
+        _distance(point, centroids[label])
+        for point, label in zip(points, labels)
+    )
+    return labels, centroids, distortion
+
+
+def bic(
+    points: Sequence[Vector], labels: Sequence[int], distortion: float
+) -> float:
+    """
+    The BIC score of a clustering, modelling each cluster as a spherical
+    Gaussian with a variance shared by all clusters (Pelleg and Moore,
+    "X-means", ICML 2000).
+    """
+    r = len(points)
+    m = len(points[0])
+    sizes = [labels.count(c) for c in set(labels)]
+    k = len(sizes)
+    if r <= k:
+        return -math.inf
+
+    variance = max(distortion / (r - k), 1e-300) / m
+    likelihood = 0.0
+    for size in sizes:
+        likelihood += (
+            size * math.log(size)
+            - size * math.log(r)
+            - size * m / 2 * math.log(2 * math.pi * variance)
+            - (size - k) / 2
+        )
+    params = (k - 1) + m * k + 1
+    return likelihood - params / 2 * math.log(r)
+
+
+def find_simpoints(
+    bbvs: Sequence[Dict[int, int]],
+    max_k: int = 30,
+    dims: int = 15,
+    seeds: int = 5,
+    bic_threshold: float = 0.9,
+    seed: int = 1,
+) -> Tuple[List[int], List[float]]:
+    """
+    Pick SimPoints from a list of BBVs.
+
+    :param bbvs: The BBV of each interval, e.g., from ``read_bbv``.
+    :param max_k: The maximum number of clusters (and thus SimPoints).
+    :param dims: The number of dimensions the BBVs are projected to.
+    :param seeds: The number of k-means runs (with different initial
+                  centroids) per k. The one with the lowest distortion wins.
+    :param bic_threshold: Pick the smallest k scoring at least this fraction
+                          of the way from the worst to the best BIC score.
+    :param seed: The seed for the projection and the k-means
+                 initialisation.
+    :returns: The SimPoints (interval indices, in ascending order) and their
+              weights.
+    """
+    if not bbvs:
+        raise ValueError("There are no BBVs to cluster.")
+
+    points = project(bbvs, dims, seed)
+    rng = random.Random(seed)
+
+    results = []
+    for k in range(1, min(max_k, len(points)) + 1):
+        best = None
+        for _ in range(seeds):
+            labels, centroids, distortion = kmeans(points, k, rng)
+            if best is None or distortion < best[2]:
+                best = (labels, centroids, distortion)
+        results.append((bic(points, best[0], best[2]),) + best)
+
+    scores = [result[0] for result in results if result[0] > -math.inf]
+    lowest = min(scores, default=0.0)
+    highest = max(scores, default=0.0)
+    for score, labels, centroids, _ in results:
+        if score >= lowest + bic_threshold * (highest - lowest):
+            break
+
+    simpoints = []
+    for c, centroid in enumerate(centroids):
+        members = [i for i, label in enumerate(labels) if label == c]
+        if not members:
+            continue
+        closest = min(members, key=lambda i: _distance(points[i], centroid))
+        simpoints.append((closest, len(members) / len(points)))
+    simpoints.sort()
+
+    return [s for s, _ in simpoints], [w for _, w in simpoints]
+
+
+def write_simpoints(
+    simpoints: Sequence[int],
+    weights: Sequence[float],
+    simpoint_path: str,
+    weight_path: str,
+) -> None:
+    """
+    Write SimPoints and their weights in the SimPoint 3.2 format, i.e.,
+    ``<interval> <id>`` and ``<weight> <id>`` lines.
+    """
+    with open(simpoint_path, "w") as simpoint_file, open(
+        weight_path, "w"
+    ) as weight_file:
+        for i, (simpoint, weight) in enumerate(zip(simpoints, weights)):
+            simpoint_file.write(f"{simpoint} {i}\n")
+            weight_file.write(f"{weight} {i}\n")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(
+        description="Pick SimPoints from a gem5 BBV file."
+    )
+    parser.add_argument("bbv", help="The BBV file (e.g., simpoint.bb.gz)")
+    parser.add_argument("--simpoints", default="simpoints.txt")
+    parser.add_argument("--weights", default="weights.txt")
+    parser.add_argument("--max-k", type=int, default=30)
+    parser.add_argument("--dims", type=int, default=15)
+    parser.add_argument("--seeds", type=int, default=5)
+    parser.add_argument("--bic-threshold", type=float, default=0.9)
+    parser.add_argument("--seed", type=int, default=1)
+    args = parser.parse_args()
+
+    simpoints, weights = find_simpoints(
+        read_bbv(args.bbv),
+        max_k=args.max_k,
+        dims=args.dims,
+        seeds=args.seeds,
+        bic_threshold=args.bic_threshold,
+        seed=args.seed,
+    )
+    write_simpoints(simpoints, weights, args.simpoints, args.weights)
+
+
+if __name__ == "__main__":
+    main()
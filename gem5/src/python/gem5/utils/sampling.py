@@ -0,0 +1,229 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Periodic sampled simulation in the style of SMARTS (Wunderlich et al.,
+"SMARTS: Accelerating Microarchitecture Simulation via Rigorous Statistical
+Sampling", ISCA 2003).
+
+The workload is split into periods of ``interval`` instructions. For most of
+each period the processor fast-forwards on its starting (atomic) cores, which
+keeps the caches warm. The last ``warmup + detail`` instructions of a period
+run on the switched-in (detailed) cores: the first ``warmup`` instructions
+warm up the remaining microarchitectural state (pipeline, branch predictors,
+MSHRs, ...) and the CPI over the final ``detail`` instructions is recorded as
+one sample. Phase lengths are counted on the first core, while the CPI of a
+sample covers all of them. The CPI of the whole run is estimated from the
+mean of the samples, along with a confidence interval.
+
+Example
+-------
+
+.. code-block:: python
+
+    processor = SimpleSwitchableProcessor(
+        starting_core_type=CPUTypes.ATOMIC,
+        switch_core_type=CPUTypes.O3,
+        isa=ISA.X86,
+        num_cores=1,
+    )
+    ...
+    sampler = SmartsSampler(
+        processor, interval=1_000_000, warmup=2000, detail=1000
+    )
+    simulator = Simulator(
+        board=board,
+        on_exit_event={ExitEvent.MAX_INSTS: sampler.get_generator()},
+    )
+    simulator.run()
+
+    low, high = sampler.get_confidence_interval()
+    print(f"CPI {sampler.get_cpi()} ({low} - {high})")
+"""
+
+import math
+from statistics import (
+    NormalDist,
+    mean,
+    stdev,
+)
+from typing import (
+    Generator,
+    List,
+    Optional,
+    Tuple,
+)
+
+from m5.util import fatal
+
+from ..components.processors.simple_switchable_processor import (
+    SimpleSwitchableProcessor,
+)
+
+
+class SmartsSampler:
+    """
+    Drives a ``SimpleSwitchableProcessor`` through periodic fast-forward,
+    warmup and measurement phases and collects the CPI of each measurement.
+    """
+
+    def __init__(
+        self,
+        processor: SimpleSwitchableProcessor,
+        interval: int,
+        warmup: int,
+        detail: int,
+        confidence: float = 0.997,
+        max_samples: Optional[int] = None,
+    ) -> None:
+        """
+        :param processor: The processor to sample. It must start on the cores
+                          used for fast-forwarding.
+        :param interval: The number of instructions in each sampling period.
+        :param warmup: The number of instructions each sample is preceded by
+                       on the detailed cores, to warm up their state.
+        :param detail: The number of instructions measured for each sample.
+        :param confidence: The confidence level of the interval returned by
+                           ``get_confidence_interval``. SMARTS uses 99.7%.
+        :param max_samples: Stop the simulation after this many samples. If
+                            not set, sampling continues until the workload
+                            exits.
+        """
+        if warmup < 0 or detail <= 0:
+            fatal(
+                "SmartsSampler needs a non-negative warmup and a positive "
+                "detail length."
+            )
+        if interval <= warmup + detail:
+            fatal(
+                f"The sampling interval ({interval}) must be longer than "
+                f"warmup and detail together ({warmup + detail})."
+            )
+        if not 0 < confidence < 1:
+            fatal("The confidence level must be between 0 and 1.")
+
+        self._processor = processor
+        self._interval = interval
+        self._warmup = warmup
+        self._detail = detail
+        self._confidence = confidence
+        self._max_samples = max_samples
+        self._samples = []
+
+        self._schedule(interval - warmup - detail, initialized=False)
+
+    def _schedule(self, insts: int, initialized: bool = True) -> None:
+        # Phases are counted in instructions of the first core only. Had
+        # every core been given a stop, the ones that didn't trigger would
+        # be left behind on cores that are switched out, and fire early
+        # once they are switched back in.
+        core = self._processor.get_cores()[0]
+        core._set_inst_stop_any_thread(insts, initialized)
+
+    def _counters(self) -> Tuple[int, int]:
+        cycles = 0
+        insts = 0
+        for core in self._processor.get_cores():
+            cpu = core.get_simobject()
+            cycles += cpu.resolveStat("numCycles").value
+            for tid in range(int(cpu.numThreads)):
+                insts += cpu.resolveStat(f"commitStats{tid}.numInsts").value
+        return cycles, insts
+
+    def get_generator(self) -> Generator[bool, None, None]:
+        """
+        The generator to handle ``ExitEvent.MAX_INSTS`` with. It switches
+        between the cores and records the samples. The simulation loop exits
+        once ``max_samples`` samples have been taken.
+        """
+        while True:
+            # End of fast-forwarding, switch to the detailed cores.
+            self._processor.switch()
+            if self._warmup:
+                self._schedule(self._warmup)
+                yield False
+
+            # End of warmup, start measuring.
+            start = self._counters()
+            self._schedule(self._detail)
+            yield False
+
+            # End of the measurement.
+            cycles, insts = (
+                end - begin for end, begin in zip(self._counters(), start)
+            )
+            if insts:
+                self._samples.append(cycles / insts)
+
+            self._processor.switch()
+            self._schedule(self._interval - self._warmup - self._detail)
+            yield (
+                self._max_samples is not None
+                and len(self._samples) >= self._max_samples
+            )
+
+    def get_samples(self) -> List[float]:
+        """The CPI of each sample taken so far."""
+        return list(self._samples)
+
+    def get_cpi(self) -> float:
+        """The estimated CPI, i.e., the mean CPI of the samples."""
+        if not self._samples:
+            fatal("No samples have been taken.")
+        return mean(self._samples)
+
+    def _z(self) -> float:
+        return NormalDist().inv_cdf((1 + self._confidence) / 2)
+
+    def get_coefficient_of_variation(self) -> float:
+        """The coefficient of variation of the sample CPIs."""
+        if len(self._samples) < 2:
+            fatal("At least two samples are needed.")
+        return stdev(self._samples) / mean(self._samples)
+
+    def get_confidence_interval(self) -> Tuple[float, float]:
+        """
+        The confidence interval of the CPI estimate at the confidence level
+        given to the constructor.
+        """
+        cpi = self.get_cpi()
+        half_width = (
+            self._z()
+            * self.get_coefficient_of_variation()
+            * cpi
+            / math.sqrt(len(self._samples))
+        )
+        return cpi - half_width, cpi + half_width
+
+    def get_required_samples(self, error: float = 0.03) -> int:
+        """
+        The number of samples needed for the CPI estimate to be within
+        ``error`` (relative) of the true CPI at the configured confidence
+        level, based on the variation observed so far.
+        """
+        return math.ceil(
+            (self._z() * self.get_coefficient_of_variation() / error) ** 2
+        )
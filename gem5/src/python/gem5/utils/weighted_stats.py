@@ -0,0 +1,167 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Combine the stats of SimPoint runs into an estimate for the whole program.
+
+Each SimPoint run writes its own ``stats.txt``. The estimate for a stat is the
+weighted sum of its value in each run, with the weights of the SimPoints. Only
+the last dump in each file is used, which, when restoring from a SimPoint
+checkpoint, is the dump taken at the end of the SimPoint after the warmup
+stats were reset.
+
+This module doesn't depend on gem5 and can also be used from the command
+line:
+
+```
+python3 weighted_stats.py --weights weights.txt \\
+    m5out-0/stats.txt m5out-1/stats.txt ...
+```
+
+The stats files must be given in the order of the lines of the weights file.
+"""
+
+import argparse
+import math
+from typing import (
+    Dict,
+    List,
+    Sequence,
+)
+
+_BEGIN = "---------- Begin Simulation Statistics ----------"
+_END = "---------- End Simulation Statistics   ----------"
+
+
+def read_stats(path: str) -> Dict[str, float]:
+    """
+    Read the last dump of a gem5 text stats file.
+
+    :param path: The ``stats.txt`` file.
+    :returns: The value of each stat, by name. Stats whose values aren't
+              numbers (e.g., ``nan``) are left out.
+    """
+    dumps = []
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if line == _BEGIN:
+                dumps.append({})
+            elif line == _END or not line or not dumps:
+                continue
+            else:
+                fields = line.split()
+                if len(fields) < 2:
+                    continue
+                try:
+                    value = float(fields[1])
+                except ValueError:
+                    continue
+                if math.isfinite(value):
+                    dumps[-1][fields[0]] = value
+    if not dumps:
+        raise ValueError(f"There are no stats dumps in '{path}'.")
+    return dumps[-1]
+
+
+def read_weights(path: str) -> List[float]:
+    """
+    Read a SimPoint weights file, i.e., ``<weight> <id>`` lines.
+    """
+    with open(path) as f:
+        return [float(line.split()[0]) for line in f if line.strip()]
+
+
+def merge_stats(
+    stats: Sequence[Dict[str, float]], weights: Sequence[float]
+) -> Dict[str, float]:
+    """
+    Combine the stats of several SimPoints.
+
+    The weights are normalised to sum to one over the runs which have a
+    stat, so a stat missing from some runs is estimated from the others.
+
+    Note the estimate of a ratio (e.g., CPI) is the weighted mean of the
+    ratios. For rates over the whole program, divide the merged numerator
+    and denominator stats (e.g., ``numCycles`` and ``numInsts``) instead.
+
+    :param stats: The stats of each run, e.g., from ``read_stats``.
+    :param weights: The weight of each run.
+    :returns: The estimate of each stat, by name.
+    """
+    if len(stats) != len(weights):
+        raise ValueError(
+            f"There are {len(stats)} stats but {len(weights)} weights."
+        )
+
+    sums = {}
+    totals = {}
+    for run, weight in zip(stats, weights):
+        for name, value in run.items():
+            sums[name] = sums.get(name, 0.0) + weight * value
+            totals[name] = totals.get(name, 0.0) + weight
+
+    return {
+        name: sums[name] / totals[name] for name in sums if totals[name] > 0
+    }
+
+
+def write_stats(stats: Dict[str, float], path: str) -> None:
+    """
+    Write merged stats in the layout of a gem5 text stats file.
+    """
+    width = max((len(name) for name in stats), default=0)
+    with open(path, "w") as f:
+        f.write(f"\n{_BEGIN}\n")
+        for name, value in stats.items():
+            f.write(f"{name:<{width}} {value:>20.6f}\n")
+        f.write(f"\n{_END}\n")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(
+        description="Combine the stats of SimPoint runs."
+    )
+    parser.add_argument(
+        "stats", nargs="+", help="The stats.txt file of each SimPoint"
+    )
+    parser.add_argument(
+        "--weights", required=True, help="The SimPoint weights file"
+    )
+    parser.add_argument("--output", default="weighted_stats.txt")
+    args = parser.parse_args()
+
+    write_stats(
+        merge_stats(
+            [read_stats(path) for path in args.stats],
+            read_weights(args.weights),
+        ),
+        args.output,
+    )
+
+
+if __name__ == "__main__":
+    main()
@@ -261,6 +261,21 @@ def parse_options():
         help="Create DOT & pdf outputs of the DVFS configuration"
         + " [Default: %default]",
     )
+    option(
+        "--config-ini-only",
+        action="store_true",
+        default=False,
+        help="Only dump config.ini, skip the JSON and DOT outputs of the "
+        "configuration",
+    )
+    option(
+        "--lazy-sim-objects",
+        action="store_true",
+        default=False,
+        help="Only import a SimObject module when one of its names is first "
+        "used. Scripts that look through m5.objects for available types "
+        "won't see the ones that haven't been used yet.",
+    )
 
     # Debugging options
     group("Debugging Options")
@@ -389,6 +404,7 @@ def main():
         defines,
         event,
         info,
+        objects,
         stats,
         trace,
     )
@@ -402,6 +418,14 @@ def main():
 
     m5.options = options
 
+    if not options.lazy_sim_objects:
+        objects.loadAll()
+
+    if options.config_ini_only:
+        options.json_config = None
+        options.dot_config = None
+        options.dot_dvfs_config = None
+
     # Set the main event queue for the main thread.
     event.mainq = event.getEventQueue(0)
     event.setEventQueue(event.mainq)
@@ -470,6 +494,7 @@ def main():
     if options.list_sim_objects:
         from . import SimObject
 
+        objects.loadAll()
         done = True
         print("SimObjects:")
         objects = list(SimObject.allClasses.keys())
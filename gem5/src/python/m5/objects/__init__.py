@@ -24,6 +24,100 @@
 # (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
-for module in __spec__.loader_state:
-    if module.startswith("m5.objects."):
-        exec(f"from {module} import *")
+# The SimObject modules are not executed when this package is imported.
+# Instead, a module is imported (and its public names added here, as if
+# by "from module import *") the first time one of the names it defines
+# is looked up, so a script only pays for the SimObjects it actually
+# uses. loadAll() restores the old behaviour of importing everything.
+
+import dis
+import importlib
+import importlib.util
+import sys
+import types
+
+_modules = [m for m in __spec__.loader_state if m.startswith("m5.objects.")]
+_merged = set()
+
+
+def _merge(module):
+    if module in _merged:
+        return
+    _merged.add(module)
+    mod = sys.modules[module]
+    names = getattr(mod, "__all__", None)
+    if names is None:
+        names = [n for n in vars(mod) if not n.startswith("_")]
+    globals().update((n, getattr(mod, n)) for n in names)
+
+
+class _ObjectsModule(types.ModuleType):
+    def __setattr__(self, name, value):
+        super().__setattr__(name, value)
+        # The import system sets a package attribute for each submodule
+        # once it has been executed. Merge its names at that point, no
+        # matter who imported it, so that (as before) a class shadows
+        # the module of the same name.
+        if (
+            isinstance(value, types.ModuleType)
+            and value.__name__ == f"{__name__}.{name}"
+        ):
+            _merge(value.__name__)
+
+
+sys.modules[__name__].__class__ = _ObjectsModule
+
+
+def _defines(module, name):
+    """Check whether the body of a module binds name itself (as opposed
+    to importing it from elsewhere) without executing it."""
+    code = importlib.util.find_spec(module).loader.get_code(module)
+    if name not in code.co_names:
+        return False
+    prev = None
+    for inst in dis.get_instructions(code):
+        if (
+            inst.opname == "STORE_NAME"
+            and inst.argval == name
+            and (prev is None or prev.opname != "IMPORT_FROM")
+        ):
+            return True
+        prev = inst
+    return False
+
+
+def loadAll():
+    """Import every SimObject module."""
+    for module in _modules:
+        importlib.import_module(module)
+
+
+def __getattr__(name):
+    if name == "__all__":
+        # "from m5.objects import *" gets everything.
+        loadAll()
+        return [
+            n for n in globals() if not n.startswith("_") and n not in _own
+        ]
+    if name.startswith("__"):
+        raise AttributeError(name)
+
+    for module in _modules:
+        if module not in sys.modules and _defines(module, name):
+            importlib.import_module(module)
+            break
+
+    # Names that are only re-exported (e.g. parameter types) aren't bound
+    # by any module body, so fall back to importing everything.
+    if name not in globals():
+        loadAll()
+
+    try:
+        return globals()[name]
+    except KeyError:
+        raise AttributeError(
+            f"module 'm5.objects' has no attribute '{name}'"
+        ) from None
+
+
+_own = set(globals())
@@ -187,8 +187,20 @@ class ParamDesc:
         if attr == "ptype":
             from . import SimObject
 
-            ptype = SimObject.allClasses[self.ptype_str]
-            assert isSimObjectClass(ptype)
+            if (
+                self.ptype_str not in SimObject.allClasses
+                and self.ptype_str not in allParams
+            ):
+                # The module defining the type may not have been loaded
+                # yet, see m5.objects.
+                from m5 import objects
+
+                getattr(objects, self.ptype_str, None)
+
+            ptype = allParams.get(self.ptype_str)
+            if ptype is None:
+                ptype = SimObject.allClasses[self.ptype_str]
+                assert isSimObjectClass(ptype)
             self.ptype = ptype
             return ptype
 
@@ -99,14 +99,18 @@ def instantiate(ckpt_dir=None):
     for obj in root.descendants():
         obj.adoptOrphanParams()
 
+    # The tree doesn't change from here on. Walking it means sorting the
+    # children of every object, so only do that once.
+    sim_objects = list(root.descendants())
+
     # Unproxy in sorted order for determinism
-    for obj in root.descendants():
+    for obj in sim_objects:
         obj.unproxyParams()
 
     if options.dump_config:
         ini_file = open(os.path.join(options.outdir, options.dump_config), "w")
         # Print ini sections in sorted order for easier diffing
-        for obj in sorted(root.descendants(), key=lambda o: o.path()):
+        for obj in sorted(sim_objects, key=lambda o: o.path()):
             obj.print_ini(ini_file)
         ini_file.close()
 
@@ -130,14 +134,20 @@ def instantiate(ckpt_dir=None):
     # Initialize the global statistics
     stats.initSimStats()
 
+    # Sharded stats keep a copy of their counters per event queue, so
+    # the number of queues must be known before any stat is created.
+    stats.setNumShards(
+        max(int(obj.eventq_index) for obj in sim_objects) + 1
+    )
+
     # Create the C++ sim objects and connect ports
-    for obj in root.descendants():
+    for obj in sim_objects:
         obj.createCCObject()
-    for obj in root.descendants():
+    for obj in sim_objects:
         obj.connectPorts()
 
     # Do a second pass to finish initializing the sim objects
-    for obj in root.descendants():
+    for obj in sim_objects:
         obj.init()
 
     # Do a third pass to initialize statistics
@@ -145,11 +155,11 @@ def instantiate(ckpt_dir=None):
     root.regStats()
 
     # Do a fourth pass to initialize probe points
-    for obj in root.descendants():
+    for obj in sim_objects:
         obj.regProbePoints()
 
     # Do a fifth pass to connect probe listeners
-    for obj in root.descendants():
+    for obj in sim_objects:
         obj.regProbeListeners()
 
     # We want to generate the DVFS diagram for the system. This can only be
@@ -165,10 +175,10 @@ def instantiate(ckpt_dir=None):
     if ckpt_dir:
         _drain_manager.preCheckpointRestore()
         ckpt = _m5.core.getCheckpoint(ckpt_dir)
-        for obj in root.descendants():
+        for obj in sim_objects:
             obj.loadState(ckpt)
     else:
-        for obj in root.descendants():
+        for obj in sim_objects:
             obj.initState()
 
     # Check to see if any of the stat events are in the past after resuming from
@@ -437,7 +447,7 @@ def notifyFork(root):
 fork_count = 0
 
 
-def fork(simout="%(parent)s.f%(fork_seq)i"):
+def fork(simout="%(parent)s.f%(fork_seq)i", **fmt_args):
     """Fork the simulator.
 
     This function forks the simulator. After forking the simulator,
@@ -454,6 +464,7 @@ def fork(simout="%(parent)s.f%(fork_seq)i"):
 
     Keyword Arguments:
       simout -- New simulation output directory.
+      fmt_args -- Additional entries of the formatting dictionary.
 
     Return Value:
       pid of the child process or 0 if running in the child.
@@ -485,6 +496,7 @@ def fork(simout="%(parent)s.f%(fork_seq)i"):
             "parent": parent,
             "fork_seq": fork_count,
             "pid": os.getpid(),
+            **fmt_args,
         }
         _m5.core.setOutputDir(options.outdir)
     else:
@@ -493,6 +505,91 @@ def fork(simout="%(parent)s.f%(fork_seq)i"):
     return pid
 
 
+def forkSweep(
+    system,
+    sweep_points,
+    simout="%(parent)s.sweep%(point)i",
+    max_parallel=None,
+    verbose=True,
+):
+    """Fork the simulator once per sweep point.
+
+    This function drains the simulator and forks one child per sweep
+    point. Each child switches to the CPUs of its sweep point and gets
+    its own output directory, while the guest memory is shared
+    copy-on-write with the parent and the other children. This makes it
+    possible to reach a region of interest once and then simulate it with
+    differently configured CPUs. The new CPUs of all the sweep points
+    must be instantiated, switched out, along with the system.
+
+    Typical use:
+      point = m5.forkSweep(system, [[(system.cpu, cpu)] for cpu in o3s])
+      if point is None:
+          sys.exit(0)
+      exit_event = m5.simulate()
+
+    As with fork(), listeners must be disabled, and backing stores that
+    are shared with other processes are shared by the children too.
+
+    Output file formatting dictionary:
+      parent -- Path to the parent process's output directory.
+      fork_seq -- Fork sequence number.
+      pid -- PID of the child process.
+      point -- Index of the sweep point.
+
+    Arguments:
+      system -- Simulated system.
+      sweep_points -- List of switchCpus() (old_cpu, new_cpu) lists.
+
+    Keyword Arguments:
+      simout -- Simulation output directory of the children.
+      max_parallel -- Maximum number of children running at the same
+                      time, unbounded if None.
+      verbose -- Print the progress of the sweep.
+
+    Return Value:
+      Index of the sweep point if running in a child. None in the parent,
+      once all the children have exited.
+    """
+
+    if not isinstance(sweep_points, list) or not sweep_points:
+        raise RuntimeError("Must pass a non-empty list of sweep points")
+
+    running = {}
+    failed = []
+
+    def wait_child():
+        pid, status = os.wait()
+        point = running.pop(pid, None)
+        if point is None:
+            return
+        if status != 0:
+            failed.append(point)
+        if verbose:
+            print(f"Sweep point {point} exited with status {status}")
+
+    for point, cpu_list in enumerate(sweep_points):
+        while max_parallel and len(running) >= max_parallel:
+            wait_child()
+
+        pid = fork(simout, point=point)
+        if pid == 0:
+            switchCpus(system, cpu_list, verbose=verbose)
+            return point
+
+        if verbose:
+            print(f"Sweep point {point} running as pid {pid}")
+        running[pid] = point
+
+    while running:
+        wait_child()
+
+    if failed:
+        raise RuntimeError(f"Sweep points {sorted(failed)} failed")
+
+    return None
+
+
 from _m5.core import (
     curTick,
     disableAllListeners,
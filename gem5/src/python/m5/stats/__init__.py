@@ -49,6 +49,7 @@ import _m5.stats
 
 # Stat exports
 from _m5.stats import periodicStatDump
+from _m5.stats import setNumShards
 from _m5.stats import schedStatEvent as schedEvent
 
 from .gem5stats import JsonOutputVistor
@@ -134,23 +135,29 @@ def _url_factory(schemes, enable=True):
 
 
 @_url_factory([None, "", "text", "file"])
-def _textFactory(fn, desc=True, spaces=True):
+def _textFactory(fn, desc=True, spaces=True, incremental=False):
     """Output stats in text format.
 
     Text stat files contain one stat per line with an optional
     description. The description is enabled by default, but can be
     disabled by setting the desc parameter to False.
 
+    Incremental stat files only contain the stats that changed since
+    the previous dump, which makes frequent periodic dumps of mostly
+    idle systems considerably cheaper. The first dump is always
+    complete.
+
     Parameters:
       * desc (bool): Output stat descriptions (default: True)
       * spaces (bool): Output alignment spaces (default: True)
+      * incremental (bool): Only output changed stats (default: False)
 
     Example:
       text://stats.txt?desc=False;spaces=False
 
     """
 
-    return _m5.stats.initText(fn, desc, spaces)
+    return _m5.stats.initText(fn, desc, spaces, incremental)
 
 
 @_url_factory(["h5"], enable=hasattr(_m5.stats, "initHDF5"))
@@ -190,6 +197,38 @@ def _hdf5Factory(fn, chunking=10, desc=True, formulas=True):
     return _m5.stats.initHDF5(fn, chunking, desc, formulas)
 
 
+@_url_factory(["bin"])
+def _columnarFactory(fn, delta=True, compression=1, desc=False, formulas=True):
+    """Output stats in a compact columnar binary format.
+
+    The stat names are written once and every dump appends a frame
+    holding one value per stat, which keeps frequent periodic dumps
+    cheap both in time and in space. Frames can be XOR-encoded against
+    the previous dump, so values that didn't change compress to almost
+    nothing.
+
+    Use m5.stats.columnar.read() or read_frame() to load the file into
+    numpy arrays or a pandas DataFrame.
+
+    Known limitations:
+      * Sparse histograms only store their number of samples.
+
+    Parameters:
+      * delta (bool): Encode each dump against the previous one
+        (default: True)
+      * compression (int): zlib compression level, 0 to disable
+        (default: 1)
+      * desc (bool): Output stat descriptions (default: False)
+      * formulas (bool): Output derived stats (default: True)
+
+    Example:
+      bin://stats.bin?compression=6;desc=True
+
+    """
+
+    return _m5.stats.initColumnar(fn, delta, compression, desc, formulas)
+
+
 @_url_factory(["json"])
 def _jsonFactory(fn):
     """Output stats in JSON format.
@@ -356,6 +395,27 @@ def prepare():
     _visit_stats(lambda g, s: s.prepare())
 
 
+def _clear_dirty(roots=None):
+    """Start tracking stat modifications for the next dump. This is
+    only done once a dump has completed, other users of prepare() must
+    not hide changes from incremental outputs."""
+
+    def clear(g, stat):
+        stat.clearDirty()
+
+    if roots:
+        for root in roots:
+            for stat in root.getStats():
+                clear(root, stat)
+            _visit_stats(clear, root=root)
+    else:
+        _visit_stats(clear)
+
+        # Legacy stats
+        for stat in stats_list:
+            stat.clearDirty()
+
+
 def _dump_to_visitor(visitor, roots=None):
     # New stats
     def dump_group(group):
@@ -429,6 +489,8 @@ def dump(roots=None):
                 _dump_to_visitor(output, roots=all_roots)
                 output.end()
 
+    _clear_dirty(all_roots)
+
 
 def reset():
     """Reset all statistics to the base state"""
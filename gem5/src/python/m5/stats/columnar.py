@@ -0,0 +1,172 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Reader for the columnar binary stat files written by the "bin" stat
+output (see src/base/stats/columnar.hh for the file format).
+
+This module only depends on the Python standard library and numpy, so
+it can also be used outside of gem5 to post-process stat files:
+
+    from m5.stats.columnar import read
+    ticks, columns, values = read("m5out/stats.bin")
+
+pandas users can get a data frame indexed by tick using read_frame().
+"""
+
+import struct
+import zlib
+
+_MAGIC = b"gem5col\x01"
+_HEADER = struct.Struct("<IIQQ")
+
+_SCHEMA_RECORD = 1
+_FRAME_RECORD = 2
+
+_XOR_DELTA = 0x1
+_DEFLATE = 0x2
+
+
+def _records(fn):
+    with open(fn, "rb") as f:
+        data = f.read()
+
+    if data[: len(_MAGIC)] != _MAGIC:
+        raise ValueError(f"{fn} is not a columnar stat file")
+
+    pos = len(_MAGIC)
+    while pos + _HEADER.size <= len(data):
+        rtype, flags, raw_size, size = _HEADER.unpack_from(data, pos)
+        pos += _HEADER.size
+        payload = data[pos : pos + size]
+        if len(payload) != size:
+            # Truncated record, e.g., the simulation is still running.
+            break
+        pos += size
+        if flags & _DEFLATE:
+            payload = zlib.decompress(payload)
+        if len(payload) != raw_size:
+            raise ValueError(f"Corrupt record in {fn}")
+        yield rtype, flags, payload
+
+
+def _string(payload, pos):
+    (length,) = struct.unpack_from("<I", payload, pos)
+    pos += 4
+    return payload[pos : pos + length].decode(), pos + length
+
+
+def _parse_schema(payload):
+    columns = []
+    descs = {}
+    (count,) = struct.unpack_from("<I", payload, 0)
+    pos = 4
+    for _ in range(count):
+        _, size = struct.unpack_from("<BI", payload, pos)
+        pos += 5
+        name, pos = _string(payload, pos)
+        desc, pos = _string(payload, pos)
+        if desc:
+            descs[name] = desc
+        for _ in range(size):
+            label, pos = _string(payload, pos)
+            if not label:
+                columns.append(name)
+            else:
+                columns.append(f"{name}::{label}")
+    return columns, descs
+
+
+def read(fn, descriptions=None):
+    """Read a columnar stat file.
+
+    Returns a tuple (ticks, columns, values) where ticks is an array
+    holding the tick of every dump, columns is the list of value names
+    (e.g., "system.cpu.ipc" or "system.mem_ctrl.readReqs::0") and
+    values is a 2-d array with one row per dump and one column per
+    name. Values that were not dumped in a given dump, e.g., because
+    a stat was added later, are NaN.
+
+    If descriptions is a dictionary, it is populated with the stat
+    descriptions stored in the file.
+    """
+
+    import numpy as np
+
+    columns = []
+    column_index = {}
+    ticks = []
+    # List of (column indices, raw frame words) per segment of
+    # frames sharing a schema.
+    segments = []
+    indices = None
+    last = None
+
+    for rtype, flags, payload in _records(fn):
+        if rtype == _SCHEMA_RECORD:
+            names, descs = _parse_schema(payload)
+            if descriptions is not None:
+                descriptions.update(descs)
+            for name in names:
+                if name not in column_index:
+                    column_index[name] = len(columns)
+                    columns.append(name)
+            indices = np.array([column_index[n] for n in names], dtype=np.intp)
+            segments.append((indices, []))
+            last = None
+        elif rtype == _FRAME_RECORD:
+            if indices is None:
+                raise ValueError(f"Frame without a schema in {fn}")
+            words = np.frombuffer(payload, dtype="<u8")
+            ticks.append(int(words[0]))
+            frame = words[1:]
+            if flags & _XOR_DELTA:
+                frame = frame ^ last
+            last = frame
+            segments[-1][1].append(frame)
+
+    values = np.full((len(ticks), len(columns)), np.nan)
+    row = 0
+    for indices, frames in segments:
+        if not frames:
+            continue
+        block = np.stack(frames).astype(np.uint64).view("<f8")
+        values[row : row + len(frames), indices] = block
+        row += len(frames)
+
+    return np.array(ticks, dtype=np.uint64), columns, values
+
+
+def read_frame(fn):
+    """Read a columnar stat file into a pandas DataFrame indexed by
+    tick with one column per stat value."""
+
+    import pandas as pd
+
+    ticks, columns, values = read(fn)
+    return pd.DataFrame(
+        values, index=pd.Index(ticks, name="tick"), columns=columns
+    )
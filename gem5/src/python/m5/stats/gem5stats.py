@@ -29,6 +29,7 @@ This serves as the bridge between the gem5 statistics exposed via PyBind11 and
 the Python Stats model.
 """
 
+import re
 from datetime import datetime
 from typing import (
     IO,
@@ -40,8 +41,9 @@ from m5.ext.pystats.group import *
 from m5.ext.pystats.simstat import *
 from m5.ext.pystats.statistic import *
 from m5.ext.pystats.storagetype import *
-from m5.objects import *
+from m5.objects import Root
 from m5.params import SimObjectVector
+from m5.SimObject import SimObject
 
 import _m5.stats
 
@@ -42,6 +42,7 @@
 #include "pybind11/stl.h"
 
 #include "base/statistics.hh"
+#include "base/stats/columnar.hh"
 #include "base/stats/text.hh"
 #include "config/have_hdf5.hh"
 
@@ -111,8 +112,14 @@ pybind_init_stats(py::module_ &m_native)
 
     m
         .def("initSimStats", &statistics::initSimStats)
+        .def("setNumShards", [](statistics::size_type num_shards) {
+                fatal_if(num_shards == 0,
+                         "Sharded stats need at least one shard.\n");
+                statistics::numShards = num_shards;
+            })
         .def("initText", &statistics::initText,
             py::return_value_policy::reference)
+        .def("initColumnar", &statistics::initColumnar)
 #if HAVE_HDF5
         .def("initHDF5", &statistics::initHDF5)
 #endif
@@ -154,6 +161,7 @@ pybind_init_stats(py::module_ &m_native)
         .def("baseCheck", &statistics::Info::baseCheck)
         .def("enable", &statistics::Info::enable)
         .def("prepare", &statistics::Info::prepare)
+        .def("clearDirty", &statistics::Info::clearDirty)
         .def("reset", &statistics::Info::reset)
         .def("zero", &statistics::Info::zero)
         .def("visit", &statistics::Info::visit)
@@ -104,6 +104,31 @@ class System(SimObject):
         "shared_backstore is non-empty.",
     )
 
+    pmem_checkpoint_chunk_size = Param.MemorySize(
+        "0",
+        "Size of the independent chunks the physical memory is "
+        "checkpointed in (e.g. 1MiB), 0 to write each backing store as a "
+        "single gzip stream. All-zero chunks are not stored. Checkpoints "
+        "taken in chunks can't be restored by gem5 versions that don't "
+        "support them.",
+    )
+    pmem_checkpoint_compress = Param.Bool(
+        True, "Compress the physical memory checkpoint chunks."
+    )
+    pmem_checkpoint_map_chunks = Param.Bool(
+        False,
+        "Map uncompressed physical memory checkpoint chunks copy-on-write "
+        "from the checkpoint file when restoring a private backing store, "
+        "instead of reading them. Mapped chunks are file backed, so they "
+        "don't get transparent huge pages, and the file must not change "
+        "while simulating.",
+    )
+    pmem_checkpoint_threads = Param.Unsigned(
+        0,
+        "Host threads used to checkpoint and restore the physical memory, "
+        "0 to use all of them",
+    )
+
     cache_line_size = Param.Unsigned(64, "Cache line size in bytes")
 
     redirect_paths = VectorParam.RedirectPath([], "Path redirections")
@@ -134,9 +134,49 @@ Event::releaseImpl()
         delete this;
 }
 
+#if USE_EVENTQ_TIMING_WHEEL
+Event *
+EventQueue::findBinBefore(Event *event) const
+{
+    // Any bin preceding the event is a valid starting point, but the
+    // closer it is to the event, the shorter the walk.
+    const size_t slot = wheelSlot(event->when());
+    for (size_t i = 0; i < wheelLookBack; ++i) {
+        Event *bin = wheel[(slot - i) & (wheelSlots - 1)];
+        if (bin && *bin < *event)
+            return bin;
+    }
+
+    return head;
+}
+
+void
+EventQueue::wheelRemove(Event *event, Event *top, Event *prev)
+{
+    Event *&bin = wheel[wheelSlot(event->when())];
+    if (bin != event)
+        return;
+
+    assert(event == top);
+    if (top->nextInBin) {
+        // The next event in the bin is its new top.
+        bin = top->nextInBin;
+    } else if (prev && wheelSlot(prev->when()) == wheelSlot(event->when())) {
+        bin = prev;
+    } else {
+        bin = nullptr;
+    }
+}
+#endif
+
 void
 EventQueue::insert(Event *event)
 {
+#if USE_EVENTQ_TIMING_WHEEL
+    // The event always ends up at the top of its bin.
+    wheel[wheelSlot(event->when())] = event;
+#endif
+
     // Deal with the head case
     if (!head || *event <= *head) {
         head = Event::insertBefore(event, head);
@@ -145,8 +185,12 @@ EventQueue::insert(Event *event)
 
     // Figure out either which 'in bin' list we are on, or where a new list
     // needs to be inserted
+#if USE_EVENTQ_TIMING_WHEEL
+    Event *prev = findBinBefore(event);
+#else
     Event *prev = head;
-    Event *curr = head->nextBin;
+#endif
+    Event *curr = prev->nextBin;
     while (curr && *curr < *event) {
         prev = curr;
         curr = curr->nextBin;
@@ -199,13 +243,20 @@ EventQueue::remove(Event *event)
     // deal with an event on the head's 'in bin' list (event has the same
     // time as the head)
     if (*head == *event) {
+#if USE_EVENTQ_TIMING_WHEEL
+        wheelRemove(event, head, nullptr);
+#endif
         head = Event::removeItem(event, head);
         return;
     }
 
     // Find the 'in bin' list that this event belongs on
+#if USE_EVENTQ_TIMING_WHEEL
+    Event *prev = findBinBefore(event);
+#else
     Event *prev = head;
-    Event *curr = head->nextBin;
+#endif
+    Event *curr = prev->nextBin;
     while (curr && *curr < *event) {
         prev = curr;
         curr = curr->nextBin;
@@ -214,6 +265,10 @@ EventQueue::remove(Event *event)
     if (!curr || *curr != *event)
         panic("event not found!");
 
+#if USE_EVENTQ_TIMING_WHEEL
+    wheelRemove(event, curr, prev);
+#endif
+
     // curr points to the top item of the the correct 'in bin' list, when
     // we remove an item, it returns the new top item (which may be
     // unchanged)
@@ -228,6 +283,10 @@ EventQueue::serviceOne()
     Event *next = head->nextInBin;
     event->flags.clear(Event::Scheduled);
 
+#if USE_EVENTQ_TIMING_WHEEL
+    wheelRemove(event, head, nullptr);
+#endif
+
     if (next) {
         // update the next bin pointer since it could be stale
         next->nextBin = head->nextBin;
@@ -383,6 +442,10 @@ EventQueue::replaceHead(Event* s)
 {
     Event* t = head;
     head = s;
+#if USE_EVENTQ_TIMING_WHEEL
+    // The wheel only indexes the bins of the current list.
+    std::fill(wheel.begin(), wheel.end(), nullptr);
+#endif
     return t;
 }
 
@@ -443,6 +506,9 @@ Event::dump() const
 
 EventQueue::EventQueue(const std::string &n)
     : objName(n), head(NULL), _curTick(0)
+#if USE_EVENTQ_TIMING_WHEEL
+      , wheel(wheelSlots, nullptr)
+#endif
 {
 }
 
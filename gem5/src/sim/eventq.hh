@@ -43,6 +43,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/debug.hh"
 #include "base/flags.hh"
@@ -51,6 +52,7 @@
 #include "base/type_traits.hh"
 #include "base/types.hh"
 #include "base/uncontended_mutex.hh"
+#include "config/use_eventq_timing_wheel.hh"
 #include "debug/Event.hh"
 #include "sim/cur_tick.hh"
 #include "sim/serialize.hh"
@@ -621,6 +623,45 @@ class EventQueue
     Event *head;
     Tick _curTick;
 
+#if USE_EVENTQ_TIMING_WHEEL
+    /**
+     * Timing wheel indexing the bins of the queue. Each slot covers
+     * 2^wheelSlotShift ticks and the wheel wraps around every
+     * wheelSlots slots. A slot either is empty or holds the top event
+     * of a bin whose tick maps to that slot, which lets insert() and
+     * remove() start walking the bins close to their target instead
+     * of at the head of the queue. The ordering of the events is not
+     * affected.
+     */
+    static constexpr unsigned wheelSlotShift = 9;
+    static constexpr size_t wheelSlots = 4096;
+    /** Number of slots searched for a bin preceding an event. */
+    static constexpr size_t wheelLookBack = 64;
+
+    std::vector<Event *> wheel;
+
+    static size_t
+    wheelSlot(Tick when)
+    {
+        return (when >> wheelSlotShift) & (wheelSlots - 1);
+    }
+
+    /**
+     * Find a bin that sorts strictly before the given event. The
+     * event must sort after the head of the queue.
+     */
+    Event *findBinBefore(Event *event) const;
+
+    /**
+     * Update the wheel after an event was removed from a bin.
+     *
+     * @param event The removed event.
+     * @param top The top of the bin before removing the event.
+     * @param prev The bin preceding the event's bin, if known.
+     */
+    void wheelRemove(Event *event, Event *top, Event *prev);
+#endif
+
     //! Mutex to protect async queue.
     UncontendedMutex async_queue_mutex;
 
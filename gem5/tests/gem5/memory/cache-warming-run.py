@@ -0,0 +1,120 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Warms the caches of a two level hierarchy up while a program writes to
+memory, installs the warmed up blocks, and checks that each block written
+is dirty in at most one level. The program then runs to completion on the
+installed caches, and must still see the data it wrote.
+"""
+
+import os
+import sys
+
+import m5
+from m5.objects import *
+
+m5.util.addToPath("../../../configs/")
+from common.Caches import *
+
+thispath = os.path.dirname(os.path.realpath(__file__))
+binary = os.path.join(
+    thispath,
+    "../../../",
+    "tests/test-progs/dirty-snoop/bin/x86/linux/dirty_snoop",
+)
+
+system = System(
+    cpu=[X86AtomicSimpleCPU(cpu_id=i) for i in range(2)],
+    membus=SystemXBar(),
+    l2bus=L2XBar(),
+    l2cache=L2Cache(size="256kB", assoc=8),
+    mem_mode="atomic",
+    mem_ranges=[AddrRange("512MB")],
+)
+system.voltage_domain = VoltageDomain()
+system.clk_domain = SrcClockDomain(
+    clock="1GHz", voltage_domain=system.voltage_domain
+)
+
+system.workload = SEWorkload.init_compatible(binary)
+process = Process(cmd=[binary])
+
+for cpu in system.cpu:
+    cpu.icache = L1_ICache(size="32kB", assoc=4)
+    cpu.dcache = L1_DCache(size="32kB", assoc=4)
+    cpu.icache.cpu_side = cpu.icache_port
+    cpu.dcache.cpu_side = cpu.dcache_port
+    cpu.icache.mem_side = system.l2bus.cpu_side_ports
+    cpu.dcache.mem_side = system.l2bus.cpu_side_ports
+
+    cpu.workload = process
+    cpu.createThreads()
+    cpu.createInterruptController()
+    cpu.interrupts[0].pio = system.membus.mem_side_ports
+    cpu.interrupts[0].int_requestor = system.membus.cpu_side_ports
+    cpu.interrupts[0].int_responder = system.membus.mem_side_ports
+
+system.l2cache.cpu_side = system.l2bus.mem_side_ports
+system.l2cache.mem_side = system.membus.cpu_side_ports
+
+system.physmem = SimpleMemory(range=system.mem_ranges[0])
+system.physmem.port = system.membus.mem_side_ports
+system.system_port = system.membus.cpu_side_ports
+
+root = Root(full_system=False, system=system)
+
+m5.instantiate()
+
+l1_caches = [c for cpu in system.cpu for c in (cpu.icache, cpu.dcache)]
+caches = [system.l2cache] + l1_caches
+for cache in caches:
+    cache.startWarming()
+# Stop in the middle of the loop filling the buffer the other thread
+# prints, once the first writes are done
+system.cpu[0].scheduleInstStop(0, 100, "cache warming complete")
+exit_event = m5.simulate()
+if exit_event.getCause() != "cache warming complete":
+    sys.exit(f"Unexpected exit while warming up: {exit_event.getCause()}")
+
+# The shared cache is installed first, as in Simulation.warmCaches
+for cache in caches:
+    cache.stopWarming()
+
+l1_dirty = set()
+for cache in l1_caches:
+    l1_dirty.update(cache.dirtyBlocks())
+l2_dirty = set(system.l2cache.dirtyBlocks())
+if not l1_dirty:
+    sys.exit("No block was installed dirty in the L1 caches")
+if l1_dirty & l2_dirty:
+    sys.exit(
+        "Blocks dirty in both the L1 and the L2 caches: "
+        + ", ".join(hex(addr) for addr in sorted(l1_dirty & l2_dirty))
+    )
+
+exit_event = m5.simulate()
+print(f"Exiting @ tick {m5.curTick()} because {exit_event.getCause()}")
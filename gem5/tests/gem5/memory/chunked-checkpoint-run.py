@@ -0,0 +1,132 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Checkpoints two backing stores in chunks and restores them. The first
+store ends with a partial chunk and holds an all-zero chunk, which is not
+stored. The restored memory is checkpointed again as a single gzip stream,
+which must hold the initial contents of the memories. The round trip is
+done with compressed chunks, and with uncompressed chunks that are mapped
+on restore.
+"""
+
+import argparse
+import gzip
+import os
+import random
+import subprocess
+import sys
+
+import m5
+from m5.objects import *
+
+MiB = 1024 * 1024
+chunk_size = MiB
+# The first memory has a data chunk, an all-zero chunk and a partial chunk
+mem_sizes = [MiB * 5 // 2, MiB]
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--save-to", help="Checkpoint the memories to this dir")
+parser.add_argument("--restore-from", help="Restore the memories first")
+parser.add_argument("--uncompressed", action="store_true")
+args = parser.parse_args()
+
+
+def image_path(outdir, i):
+    return os.path.join(outdir, f"image{i}.bin")
+
+
+def image(i):
+    size = mem_sizes[i]
+    data = bytearray(
+        random.Random(i).getrandbits(8 * size).to_bytes(size, "little")
+    )
+    if i == 0:
+        data[MiB : 2 * MiB] = bytes(MiB)
+    return bytes(data)
+
+
+def make_system():
+    restore = args.restore_from is not None
+    system = System(
+        membus=IOXBar(width=16),
+        clk_domain=SrcClockDomain(
+            clock="1GHz", voltage_domain=VoltageDomain()
+        ),
+        pmem_checkpoint_chunk_size=0 if restore else chunk_size,
+        pmem_checkpoint_compress=not args.uncompressed,
+        pmem_checkpoint_map_chunks=args.uncompressed,
+        pmem_checkpoint_threads=2,
+    )
+    start = 0
+    mems = []
+    for i, size in enumerate(mem_sizes):
+        mem = SimpleMemory(range=AddrRange(start, size=size))
+        if not restore:
+            mem.image_file = image_path(m5.options.outdir, i)
+        mem.port = system.membus.mem_side_ports
+        mems.append(mem)
+        start += size
+    system.mems = mems
+    system.system_port = system.membus.cpu_side_ports
+    return system
+
+
+def run_step(step_args):
+    status = subprocess.call(
+        [sys.executable, f"--outdir={m5.options.outdir}", __file__] + step_args
+    )
+    if status != 0:
+        sys.exit(f"Checkpointing step {step_args} failed")
+
+
+if args.save_to:
+    root = Root(full_system=False, system=make_system())
+    m5.instantiate(args.restore_from)
+    m5.simulate(1000)
+    m5.checkpoint(args.save_to)
+    sys.exit(0)
+
+for i in range(len(mem_sizes)):
+    with open(image_path(m5.options.outdir, i), "wb") as f:
+        f.write(image(i))
+
+for extra_args in ([], ["--uncompressed"]):
+    chunked = os.path.join(m5.options.outdir, "chunked")
+    restored = os.path.join(m5.options.outdir, "restored")
+    run_step([f"--save-to={chunked}"] + extra_args)
+    run_step(
+        [f"--save-to={restored}", f"--restore-from={chunked}"] + extra_args
+    )
+
+    with open(os.path.join(chunked, "m5.cpt")) as f:
+        if f.read().count(f"chunk_size={chunk_size}\n") != len(mem_sizes):
+            sys.exit("The memories were not checkpointed in chunks")
+    for i in range(len(mem_sizes)):
+        store = os.path.join(restored, f"system.physmem.store{i}.pmem")
+        with gzip.open(store) as f:
+            if f.read() != image(i):
+                sys.exit(f"Store {i} changed in the round trip {extra_args}")
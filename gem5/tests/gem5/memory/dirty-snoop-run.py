@@ -0,0 +1,90 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Runs a two threaded program where the second thread makes a syscall on data
+which is only held, dirty, in the cache of the first thread's CPU. The
+second CPU has no caches of its own, so the syscall reaches the coherent
+membus directly and must not be handed a backdoor to the stale memory.
+"""
+
+import os
+
+import m5
+from m5.objects import *
+
+m5.util.addToPath("../../../configs/")
+from common.Caches import *
+
+thispath = os.path.dirname(os.path.realpath(__file__))
+binary = os.path.join(
+    thispath,
+    "../../../",
+    "tests/test-progs/dirty-snoop/bin/x86/linux/dirty_snoop",
+)
+
+system = System(
+    cpu=[X86TimingSimpleCPU(cpu_id=i) for i in range(2)],
+    membus=SystemXBar(),
+    mem_mode="timing",
+    mem_ranges=[AddrRange("512MB")],
+)
+system.voltage_domain = VoltageDomain()
+system.clk_domain = SrcClockDomain(
+    clock="1GHz", voltage_domain=system.voltage_domain
+)
+
+system.workload = SEWorkload.init_compatible(binary)
+process = Process(cmd=[binary])
+
+# The main thread runs on the first CPU, which has caches, and the thread
+# it starts on the second, which doesn't.
+system.cpu[0].icache = L1_ICache(size="32kB", assoc=4)
+system.cpu[0].dcache = L1_DCache(size="32kB", assoc=4)
+system.cpu[0].icache.cpu_side = system.cpu[0].icache_port
+system.cpu[0].dcache.cpu_side = system.cpu[0].dcache_port
+system.cpu[0].icache.mem_side = system.membus.cpu_side_ports
+system.cpu[0].dcache.mem_side = system.membus.cpu_side_ports
+
+system.cpu[1].icache_port = system.membus.cpu_side_ports
+system.cpu[1].dcache_port = system.membus.cpu_side_ports
+
+for cpu in system.cpu:
+    cpu.workload = process
+    cpu.createThreads()
+    cpu.createInterruptController()
+    cpu.interrupts[0].pio = system.membus.mem_side_ports
+    cpu.interrupts[0].int_requestor = system.membus.cpu_side_ports
+    cpu.interrupts[0].int_responder = system.membus.mem_side_ports
+
+system.physmem = SimpleMemory(range=system.mem_ranges[0])
+system.physmem.port = system.membus.mem_side_ports
+system.system_port = system.membus.cpu_side_ports
+
+root = Root(full_system=False, system=system)
+
+m5.instantiate()
+exit_event = m5.simulate()
@@ -0,0 +1,75 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Runs garnet_synth_traffic with the routers simulated by one host thread
+and by several, and checks that the two runs have the same stats.
+"""
+
+import os
+import subprocess
+import sys
+
+import m5
+
+thispath = os.path.dirname(os.path.realpath(__file__))
+config = os.path.join(
+    thispath, "../../../", "configs/example/garnet_synth_traffic.py"
+)
+
+
+def run(threads):
+    outdir = os.path.join(m5.options.outdir, f"threads-{threads}")
+    status = subprocess.call(
+        [
+            sys.executable,
+            f"--outdir={outdir}",
+            config,
+            "--network=garnet",
+            "--topology=Mesh_XY",
+            "--mesh-rows=4",
+            "--num-cpus=16",
+            "--num-dirs=16",
+            "--synthetic=uniform_random",
+            "--injectionrate=0.1",
+            "--sim-cycles=20000",
+            f"--garnet-threads={threads}",
+        ]
+    )
+    if status != 0:
+        sys.exit(f"garnet_synth_traffic failed with {threads} threads")
+
+    # The host stats depend on the run, not on the simulated network
+    with open(os.path.join(outdir, "stats.txt")) as f:
+        return [line for line in f if not line.startswith("host")]
+
+
+single = run(1)
+multi = run(4)
+if not any("flits_received" in line for line in single):
+    sys.exit("No flits were received")
+if single != multi:
+    sys.exit("The stats depend on the number of garnet threads")
@@ -0,0 +1,140 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Runs the same traffic through two identical caches, one of which also has
+shadow tags, and checks that the stats of the two caches are the same.
+The caches use a partitioning manager and a replacement policy with
+policy-wide state (SHiP's SHCT), which the shadow tags must not update.
+"""
+
+import os
+import sys
+
+import m5
+from m5.objects import *
+
+
+def make_system(shadow_tags):
+    system = System(membus=IOXBar(width=64))
+    system.clk_domain = SrcClockDomain(
+        clock="1GHz", voltage_domain=VoltageDomain()
+    )
+    system.mem_ctrl = SimpleMemory(latency="30ns", range=AddrRange("1MiB"))
+    system.mem_ctrl.port = system.membus.mem_side_ports
+
+    system.cache = NoncoherentCache(
+        size="16KiB",
+        assoc=4,
+        tag_latency=1,
+        data_latency=1,
+        response_latency=1,
+        mshrs=4,
+        tgts_per_mshr=8,
+        replacement_policy=SHiPMemRP(),
+        partitioning_manager=PartitionManager(
+            partitioning_policies=[
+                MaxCapacityPartitioningPolicy(
+                    partition_ids=[0], capacities=[0.5]
+                )
+            ]
+        ),
+        shadow_tags=shadow_tags,
+    )
+    system.cache.mem_side = system.membus.cpu_side_ports
+
+    system.tgen = PyTrafficGen()
+    system.tgen.port = system.cache.cpu_side
+    system.system_port = system.membus.cpu_side_ports
+    return system
+
+
+root = Root(full_system=False)
+root.plain = make_system([])
+root.shadowed = make_system(
+    [
+        BaseSetAssoc(size="64KiB", assoc=8),
+        BaseSetAssoc(size="8KiB", assoc=2, replacement_policy=RandomRP()),
+    ]
+)
+root.plain.mem_mode = "timing"
+root.shadowed.mem_mode = "timing"
+
+m5.instantiate()
+
+for system in (root.plain, root.shadowed):
+    tgen = system.tgen
+    # Fixed periods and all reads or all writes, so that the traffic does
+    # not draw random numbers
+    tgen.start(
+        [
+            tgen.createLinear(10**9, 0, 32767, 64, 1000, 1000, 100, 32768),
+            tgen.createLinear(10**9, 0, 49151, 64, 1000, 1000, 0, 49152),
+            tgen.createLinear(10**9, 8192, 40959, 64, 1000, 1000, 100, 32768),
+        ]
+    )
+
+# Both generators are done after the three 1ms phases
+m5.simulate(4 * 10**9)
+m5.stats.dump()
+
+
+def cache_stats(system):
+    prefix = f"{system}.cache."
+    stats = {}
+    with open(os.path.join(m5.options.outdir, "stats.txt")) as stats_file:
+        for line in stats_file:
+            fields = line.split()
+            if len(fields) < 2 or not fields[0].startswith(prefix):
+                continue
+            name = fields[0][len(prefix) :]
+            stats[name] = fields[1]
+    return stats
+
+
+plain = cache_stats("plain")
+shadowed = cache_stats("shadowed")
+
+shadow_accesses = [
+    int(value)
+    for name, value in shadowed.items()
+    if name.startswith("shadow_tags") and name.endswith(".accesses")
+]
+if len(shadow_accesses) != 2 or min(shadow_accesses) == 0:
+    sys.exit("The shadow tags saw no accesses")
+
+shadowed = {
+    name: value
+    for name, value in shadowed.items()
+    if not name.startswith("shadow_tags")
+}
+if not plain or plain != shadowed:
+    for name in sorted(set(plain) | set(shadowed)):
+        if plain.get(name) != shadowed.get(name):
+            print(f"{name}: {plain.get(name)} != {shadowed.get(name)}")
+    sys.exit("The shadow tags changed the stats of the cache")
+
+print("Shadow tags left the cache unchanged.")
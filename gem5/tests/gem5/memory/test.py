@@ -29,6 +29,8 @@ Test file for simple memory test
 TODO: Add stats checking
 """
 
+import re
+
 from testlib import *
 
 gem5_verify_config(
@@ -70,8 +72,79 @@ gem5_verify_config(
     length=constants.long_tag,
 )
 
+gem5_verify_config(
+    name="dirty_snoop",
+    verifiers=(
+        verifier.MatchRegex(
+            re.compile("^Dirty data seen by the other thread.$"),
+            match_stderr=False,
+        ),
+    ),
+    config=joinpath(getcwd(), "dirty-snoop-run.py"),
+    config_args=[],
+    valid_isas=(constants.x86_tag,),
+    length=constants.quick_tag,
+)
+
+gem5_verify_config(
+    name="cache_warming",
+    verifiers=(
+        verifier.MatchRegex(
+            re.compile("^Dirty data seen by the other thread.$"),
+            match_stderr=False,
+        ),
+    ),
+    # The config also exits non-zero if a block is dirty in both levels
+    config=joinpath(getcwd(), "cache-warming-run.py"),
+    config_args=[],
+    valid_isas=(constants.x86_tag,),
+    length=constants.quick_tag,
+)
+
+gem5_verify_config(
+    name="shadow_tags",
+    verifiers=(),  # The config exits non-zero if the cache stats differ
+    config=joinpath(getcwd(), "shadow-tags-run.py"),
+    config_args=[],
+    valid_isas=(constants.null_tag,),
+    length=constants.quick_tag,
+)
+
+gem5_verify_config(
+    name="chunked_checkpoint",
+    verifiers=(),  # The config exits non-zero if the memory changed
+    config=joinpath(getcwd(), "chunked-checkpoint-run.py"),
+    config_args=[],
+    valid_isas=(constants.null_tag,),
+    length=constants.quick_tag,
+)
+
+gem5_verify_config(
+    name="garnet_threads",
+    verifiers=(),  # The config exits non-zero if the stats differ
+    config=joinpath(getcwd(), "garnet-threads-run.py"),
+    config_args=[],
+    valid_isas=(constants.null_tag,),
+    length=constants.quick_tag,
+)
+
 null_tests = [
     ("garnet_synth_traffic", None, ["--sim-cycles", "5000000"]),
+    (
+        "garnet_synth_traffic-analytic",
+        "garnet_synth_traffic",
+        [
+            "--sim-cycles",
+            "100000",
+            "--network=garnet",
+            "--garnet-analytic",
+            "--topology=Mesh_XY",
+            "--mesh-rows=4",
+            "--num-cpus=16",
+            "--num-dirs=16",
+            "--injectionrate=0.1",
+        ],
+    ),
     ("memcheck", None, ["--maxtick", "2000000000", "--prefetchers"]),
     (
         "ruby_mem_test-garnet",
@@ -82,6 +155,18 @@ null_tests = [
             "--network=garnet",
         ],
     ),
+    (
+        "ruby_mem_test-garnet-analytic",
+        "ruby_mem_test",
+        [
+            "--abs-max-tick",
+            "20000000",
+            "--functional",
+            "10",
+            "--network=garnet",
+            "--garnet-analytic",
+        ],
+    ),
     (
         "ruby_mem_test-simple",
         "ruby_mem_test",
@@ -55,6 +55,7 @@ from gem5.isas import (
     get_isas_str_set,
 )
 from gem5.resources.resource import obtain_resource
+from gem5.simulate.event_queue_partitioner import EventQueuePartitioner
 from gem5.simulate.simulator import Simulator
 
 cpu_types_string_map = {
@@ -107,6 +108,14 @@ parser.add_argument(
     help="The number of CPU cores to run.",
 )
 
+parser.add_argument(
+    "-t",
+    "--num-threads",
+    type=int,
+    required=False,
+    help="Run the cores on this many separate event queues.",
+)
+
 args = parser.parse_args()
 
 # Setup the system.
@@ -136,7 +145,10 @@ binary = obtain_resource(
 motherboard.set_se_binary_workload(binary, arguments=args.arguments)
 
 # Run the simulation
-simulator = Simulator(board=motherboard)
+partitioner = None
+if args.num_threads:
+    partitioner = EventQueuePartitioner(num_threads=args.num_threads)
+simulator = Simulator(board=motherboard, partitioner=partitioner)
 simulator.run()
 
 print(
@@ -28,6 +28,8 @@
 Tests which test SE mode's functionality when running workloads on multiple
 core setups.
 """
+import re
+
 from testlib import *
 
 if config.bin_path:
@@ -60,3 +62,34 @@ gem5_verify_config(
     valid_isas=(constants.all_compiled_tag,),
     length=constants.quick_tag,
 )
+
+# The same, with the cores partitioned over separate event queues. Every
+# access of the timing cores then crosses a ThreadBridge.
+for num_threads in (1, 2):
+    gem5_verify_config(
+        name=f"test-x86-hello-2-timing-core-{num_threads}-thread-se-mode",
+        fixtures=(),
+        verifiers=(verifier.MatchRegex(re.compile(r"Hello world!")),),
+        config=joinpath(
+            config.base_dir,
+            "tests",
+            "gem5",
+            "se_mode",
+            "hello_se",
+            "configs",
+            "simple_binary_run.py",
+        ),
+        config_args=[
+            "x86-hello64-static",
+            "timing",
+            "x86",
+            "--num-cores",
+            "2",
+            "--num-threads",
+            str(num_threads),
+            "--resource-directory",
+            resource_path,
+        ],
+        valid_isas=(constants.all_compiled_tag,),
+        length=constants.quick_tag,
+    )
@@ -0,0 +1,119 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""This script checks that the stats written by the "bin" stat output
+read back unchanged through m5.stats.columnar.
+
+A vector stat is dumped with its test values, reset and dumped again,
+so the second frame exercises the XOR encoding against the first one.
+"""
+
+import argparse
+import os
+import sys
+
+import m5
+from m5.objects import (
+    Root,
+    VectorStatTester,
+)
+from m5.stats import columnar
+
+parser = argparse.ArgumentParser(
+    description="Tests a round trip through the columnar stat output."
+)
+
+parser.add_argument(
+    "--delta",
+    type=int,
+    default=1,
+    help="XOR-encode each frame against the previous one.",
+)
+
+parser.add_argument(
+    "--compression",
+    type=int,
+    default=1,
+    help="zlib compression level, 0 disables it.",
+)
+
+args = parser.parse_args()
+
+values = [1.0, 2.5, -3.0, 1e20]
+subnames = ["a", "b", "c", "d"]
+
+stat_tester = VectorStatTester()
+stat_tester.name = "vector"
+stat_tester.description = "A vector statistic."
+stat_tester.values = values
+stat_tester.subnames = subnames
+
+root = Root(full_system=False, system=stat_tester)
+
+m5.stats.addStatVisitor(
+    f"bin://stats.bin?delta={bool(args.delta)};"
+    f"compression={args.compression};desc=True"
+)
+
+m5.instantiate()
+m5.simulate()
+
+m5.stats.dump()
+m5.stats.reset()
+m5.stats.dump()
+
+descriptions = {}
+ticks, columns, data = columnar.read(
+    os.path.join(m5.options.outdir, "stats.bin"), descriptions
+)
+
+errors = []
+names = [f"system.vector::{subname}" for subname in subnames]
+for name in names:
+    if name not in columns:
+        errors.append(f"Missing column {name}")
+
+if len(ticks) != 2:
+    errors.append(f"Expected 2 frames, got {len(ticks)}")
+
+if not errors:
+    for i, (name, value) in enumerate(zip(names, values)):
+        column = columns.index(name)
+        if data[0][column] != value:
+            errors.append(f"{name}: expected {value}, got {data[0][column]}")
+        if data[1][column] != 0.0:
+            errors.append(
+                f"{name}: expected 0 after reset, got {data[1][column]}"
+            )
+
+if descriptions.get("system.vector") != "A vector statistic.":
+    errors.append(f"Unexpected descriptions: {descriptions}")
+
+if errors:
+    print("Columnar stats do not round trip:", file=sys.stderr)
+    for error in errors:
+        print(f"  {error}", file=sys.stderr)
+    sys.exit(1)
@@ -252,3 +252,26 @@ gem5_verify_config(
     valid_isas=(constants.all_compiled_tag,),
     length=constants.quick_tag,
 )
+
+for delta, compression in ((1, 1), (0, 0), (1, 0)):
+    gem5_verify_config(
+        name=f"columnar-round-trip-delta{delta}-compression{compression}",
+        fixtures=(),
+        verifiers=[],
+        config=joinpath(
+            config.base_dir,
+            "tests",
+            "gem5",
+            "stats",
+            "configs",
+            "columnar_round_trip_check.py",
+        ),
+        config_args=[
+            "--delta",
+            str(delta),
+            "--compression",
+            str(compression),
+        ],
+        valid_isas=(constants.all_compiled_tag,),
+        length=constants.quick_tag,
+    )
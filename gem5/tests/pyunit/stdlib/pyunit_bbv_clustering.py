@@ -0,0 +1,97 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+import gzip
+import os
+import random
+import tempfile
+import unittest
+
+from gem5.utils.bbv_clustering import (
+    bic,
+    find_simpoints,
+    read_bbv,
+    write_simpoints,
+)
+
+
+def _phases(seed: int = 1):
+    """Three phases of 40, 20 and 40 intervals with distinct basic blocks."""
+    rng = random.Random(seed)
+    phases = [
+        {bb: rng.randint(1, 100) for bb in range(first, first + 10)}
+        for first in (0, 100, 200)
+    ]
+    bbvs = []
+    for phase, length in zip(phases, (40, 20, 40)):
+        for _ in range(length):
+            bbvs.append({bb: c + rng.randint(0, 2) for bb, c in phase.items()})
+    return bbvs
+
+
+class BBVClusteringTestSuite(unittest.TestCase):
+    """Tests the utils.bbv_clustering module."""
+
+    def test_read_bbv(self) -> None:
+        with tempfile.TemporaryDirectory() as tmp:
+            path = os.path.join(tmp, "simpoint.bb.gz")
+            with gzip.open(path, "wt") as f:
+                f.write("T:1:100 :2:50 \n")
+                f.write("T:3:7 \n")
+            self.assertEqual([{1: 100, 2: 50}, {3: 7}], read_bbv(path))
+
+    def test_find_simpoints(self) -> None:
+        simpoints, weights = find_simpoints(_phases(), max_k=6, seeds=2)
+
+        self.assertEqual(3, len(simpoints))
+        self.assertTrue(0 <= simpoints[0] < 40)
+        self.assertTrue(40 <= simpoints[1] < 60)
+        self.assertTrue(60 <= simpoints[2] < 100)
+        self.assertEqual([0.4, 0.2, 0.4], weights)
+
+    def test_single_phase(self) -> None:
+        bbvs = [{1: 10, 2: 20}] * 10
+        self.assertEqual(([0], [1.0]), find_simpoints(bbvs, max_k=4))
+
+    def test_bic_prefers_fit(self) -> None:
+        points = [[0.0], [0.1], [10.0], [10.1]]
+        one = bic(points, [0, 0, 0, 0], 100.01)
+        two = bic(points, [0, 0, 1, 1], 0.01)
+        self.assertGreater(two, one)
+
+    def test_no_bbvs(self) -> None:
+        with self.assertRaises(ValueError):
+            find_simpoints([])
+
+    def test_write_simpoints(self) -> None:
+        with tempfile.TemporaryDirectory() as tmp:
+            simpoint_path = os.path.join(tmp, "simpoints.txt")
+            weight_path = os.path.join(tmp, "weights.txt")
+            write_simpoints([3, 8], [0.25, 0.75], simpoint_path, weight_path)
+            with open(simpoint_path) as f:
+                self.assertEqual("3 0\n8 1\n", f.read())
+            with open(weight_path) as f:
+                self.assertEqual("0.25 0\n0.75 1\n", f.read())
@@ -0,0 +1,117 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+import unittest
+from types import SimpleNamespace
+
+from m5.objects import ThreadBridge
+from m5.params import VectorPortRef
+from m5.proxy import isproxy
+
+from gem5.components.boards.simple_board import SimpleBoard
+from gem5.components.cachehierarchies.classic.no_cache import NoCache
+from gem5.components.memory import SingleChannelDDR3_1600
+from gem5.components.processors.cpu_types import CPUTypes
+from gem5.components.processors.simple_processor import SimpleProcessor
+from gem5.isas import ISA
+from gem5.simulate.event_queue_partitioner import EventQueuePartitioner
+
+
+def _board(num_cores: int) -> SimpleBoard:
+    board = SimpleBoard(
+        clk_freq="1GHz",
+        processor=SimpleProcessor(
+            cpu_type=CPUTypes.TIMING, isa=ISA.X86, num_cores=num_cores
+        ),
+        memory=SingleChannelDDR3_1600(),
+        cache_hierarchy=NoCache(),
+    )
+    board._pre_instantiate()
+    return board
+
+
+def _peers(obj):
+    for ref in obj._port_refs.values():
+        elements = ref.elements if isinstance(ref, VectorPortRef) else [ref]
+        for port in elements:
+            if port.peer and not isproxy(port.peer):
+                yield port.peer.simobj
+
+
+class EventQueuePartitionerTestSuite(unittest.TestCase):
+    """Tests the simulate.event_queue_partitioner module."""
+
+    def _check_partition(self, board, root, queues):
+        cores = [
+            core.get_simobject() for core in board.get_processor().get_cores()
+        ]
+        for cpu, eventq_index in zip(cores, queues):
+            subtree = list(cpu.descendants())
+            members = set(id(obj) for obj in subtree)
+            for obj in subtree:
+                self.assertEqual(eventq_index, int(obj.eventq_index))
+                # Nothing on the core's queue talks to another queue
+                # without a bridge.
+                for peer in _peers(obj):
+                    if id(peer) not in members:
+                        self.assertIsInstance(peer, ThreadBridge)
+
+        bridges = board.event_queue_bridges
+        self.assertTrue(bridges)
+        for bridge in bridges:
+            self.assertGreaterEqual(int(bridge.delay), root.sim_quantum)
+            # Bridges connect a core's queue to the main queue.
+            queues = (int(bridge.eventq_index), int(bridge.in_eventq_index))
+            self.assertIn(0, queues)
+            self.assertNotEqual(queues[0], queues[1])
+        self.assertEqual(
+            min(int(bridge.delay) for bridge in bridges), root.sim_quantum
+        )
+
+    def test_queue_per_core(self) -> None:
+        board = _board(num_cores=2)
+        root = SimpleNamespace(sim_quantum=None)
+        EventQueuePartitioner().partition(board, root)
+
+        self._check_partition(board, root, [1, 2])
+
+    def test_grouped_cores(self) -> None:
+        board = _board(num_cores=4)
+        root = SimpleNamespace(sim_quantum=None)
+        EventQueuePartitioner(num_threads=2).partition(board, root)
+
+        self._check_partition(board, root, [1, 1, 2, 2])
+
+    def test_more_threads_than_cores(self) -> None:
+        board = _board(num_cores=2)
+        root = SimpleNamespace(sim_quantum=None)
+        EventQueuePartitioner(num_threads=8).partition(board, root)
+
+        self._check_partition(board, root, [1, 2])
+
+    def test_bad_num_threads(self) -> None:
+        with self.assertRaises(SystemExit):
+            EventQueuePartitioner(num_threads=0)
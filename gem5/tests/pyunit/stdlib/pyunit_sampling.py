@@ -0,0 +1,81 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+import unittest
+
+from gem5.components.processors.cpu_types import CPUTypes
+from gem5.components.processors.simple_switchable_processor import (
+    SimpleSwitchableProcessor,
+)
+from gem5.isas import ISA
+from gem5.utils.sampling import SmartsSampler
+
+
+def _processor() -> SimpleSwitchableProcessor:
+    return SimpleSwitchableProcessor(
+        starting_core_type=CPUTypes.ATOMIC,
+        switch_core_type=CPUTypes.O3,
+        isa=ISA.X86,
+        num_cores=1,
+    )
+
+
+class SmartsSamplerTestSuite(unittest.TestCase):
+    """Tests the utils.sampling.SmartsSampler class."""
+
+    def test_bad_interval(self) -> None:
+        with self.assertRaises(SystemExit):
+            SmartsSampler(_processor(), interval=100, warmup=50, detail=50)
+
+    def test_bad_confidence(self) -> None:
+        with self.assertRaises(SystemExit):
+            SmartsSampler(
+                _processor(),
+                interval=1000,
+                warmup=10,
+                detail=10,
+                confidence=1.0,
+            )
+
+    def test_estimate(self) -> None:
+        sampler = SmartsSampler(
+            _processor(), interval=1000, warmup=10, detail=10
+        )
+        sampler._samples = [1.0, 2.0, 3.0, 2.0]
+
+        self.assertEqual([1.0, 2.0, 3.0, 2.0], sampler.get_samples())
+        self.assertAlmostEqual(2.0, sampler.get_cpi())
+        self.assertAlmostEqual(
+            0.816496580927726 / 2.0, sampler.get_coefficient_of_variation()
+        )
+
+        # The half width is z * s / sqrt(n), with z = 2.9677 for 99.7%.
+        low, high = sampler.get_confidence_interval()
+        self.assertAlmostEqual(2.0, (low + high) / 2)
+        self.assertAlmostEqual(1.21157, (high - low) / 2, places=4)
+
+        # (z * V / e)^2 = (2.9677 * 0.40825 / 0.03)^2 = 1631.01, rounded up
+        self.assertEqual(1632, sampler.get_required_samples(0.03))
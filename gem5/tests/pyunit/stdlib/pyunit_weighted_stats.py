@@ -0,0 +1,85 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+import os
+import tempfile
+import unittest
+
+from gem5.utils.weighted_stats import (
+    merge_stats,
+    read_stats,
+    read_weights,
+)
+
+_STATS = """
+---------- Begin Simulation Statistics ----------
+simInsts                                      1000                       # Number of instructions simulated (Count)
+board.processor.cores.core.ipc                  nan                       # IPC (Count/Cycle)
+
+---------- End Simulation Statistics   ----------
+
+---------- Begin Simulation Statistics ----------
+simInsts                                      2000                       # Number of instructions simulated (Count)
+board.processor.cores.core.cpi             1.500000                       # CPI (Cycle/Count)
+board.processor.cores.core.ipc             0.666667                       # IPC (Count/Cycle)
+
+---------- End Simulation Statistics   ----------
+"""
+
+
+class WeightedStatsTestSuite(unittest.TestCase):
+    """Tests the utils.weighted_stats module."""
+
+    def test_read_stats(self) -> None:
+        with tempfile.TemporaryDirectory() as tmp:
+            path = os.path.join(tmp, "stats.txt")
+            with open(path, "w") as f:
+                f.write(_STATS)
+            stats = read_stats(path)
+
+        # Only the last dump is read.
+        self.assertEqual(2000.0, stats["simInsts"])
+        self.assertEqual(1.5, stats["board.processor.cores.core.cpi"])
+        self.assertEqual(3, len(stats))
+
+    def test_read_weights(self) -> None:
+        with tempfile.TemporaryDirectory() as tmp:
+            path = os.path.join(tmp, "weights.txt")
+            with open(path, "w") as f:
+                f.write("0.25 0\n0.75 1\n")
+            self.assertEqual([0.25, 0.75], read_weights(path))
+
+    def test_merge_stats(self) -> None:
+        merged = merge_stats(
+            [{"cpi": 1.0, "misses": 10.0}, {"cpi": 3.0}], [0.25, 0.75]
+        )
+        self.assertAlmostEqual(2.5, merged["cpi"])
+        # A stat missing from a run is estimated from the other runs.
+        self.assertAlmostEqual(10.0, merged["misses"])
+
+    def test_merge_mismatch(self) -> None:
+        with self.assertRaises(ValueError):
+            merge_stats([{"cpi": 1.0}], [0.5, 0.5])
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Checks that syscall emulation sees data which is only held, dirty, in
+ * another CPU's cache.
+ *
+ * The main thread fills a buffer, leaving the lines dirty in the cache
+ * of the CPU it runs on, then starts a second thread which writes the
+ * buffer to stdout. When the second thread runs on a CPU which isn't
+ * behind that cache, the write syscall has to read the buffer through
+ * the coherent memory system rather than straight from the memory.
+ *
+ * The program doesn't use libc so that it only relies on the clone,
+ * write and exit system calls.
+ */
+
+#define SYS_write 1
+#define SYS_clone 56
+#define SYS_exit 60
+#define SYS_exit_group 231
+
+#define CLONE_VM 0x00000100
+#define CLONE_FS 0x00000200
+#define CLONE_FILES 0x00000400
+#define CLONE_SIGHAND 0x00000800
+#define CLONE_THREAD 0x00010000
+
+static const char message[] = "Dirty data seen by the other thread.\n";
+
+static char buffer[sizeof(message) - 1];
+static volatile int done;
+static char stack[4096] __attribute__((aligned(16)));
+
+static long
+syscall3(long nr, long a, long b, long c)
+{
+    long ret;
+    asm volatile("syscall"
+                 : "=a"(ret)
+                 : "a"(nr), "D"(a), "S"(b), "d"(c)
+                 : "rcx", "r11", "memory");
+    return ret;
+}
+
+static void
+child(void)
+{
+    syscall3(SYS_write, 1, (long)buffer, sizeof(buffer));
+    done = 1;
+}
+
+/* Start fn on a new thread using stack_top, like clone(2) in libc. */
+static long
+spawn(void (*fn)(void), void *stack_top)
+{
+    long ret;
+    register long r10 asm("r10") = 0;
+    register long r8 asm("r8") = 0;
+    register void (*r12)(void) asm("r12") = fn;
+    asm volatile("syscall\n\t"
+                 "test %%rax, %%rax\n\t"
+                 "jnz 1f\n\t"
+                 "call *%%r12\n\t"
+                 "mov %[exit], %%eax\n\t"
+                 "xor %%edi, %%edi\n\t"
+                 "syscall\n\t"
+                 "1:\n\t"
+                 : "=a"(ret)
+                 : "a"((long)SYS_clone),
+                   "D"((long)(CLONE_VM | CLONE_FS | CLONE_FILES |
+                              CLONE_SIGHAND | CLONE_THREAD)),
+                   "S"(stack_top), "d"(0L), "r"(r10), "r"(r8), "r"(r12),
+                   [exit] "i"(SYS_exit)
+                 : "rcx", "r11", "memory");
+    return ret;
+}
+
+void
+_start(void)
+{
+    for (unsigned i = 0; i < sizeof(buffer); i++)
+        buffer[i] = message[i];
+
+    if (spawn(child, stack + sizeof(stack)) < 0)
+        syscall3(SYS_exit_group, 1, 0, 0);
+
+    while (!done)
+        ;
+
+    syscall3(SYS_exit_group, 0, 0, 0);
+}
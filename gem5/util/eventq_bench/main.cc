@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Event scheduling microbenchmark.
+ *
+ * The benchmark populates an event queue with a number of periodic
+ * events, which model clocked objects ticking every cycle, and a number
+ * of one-shot events with long latencies, which model in-flight memory
+ * requests. Every serviced event schedules its successor so that the
+ * queue population stays constant, and the benchmark reports the
+ * number of events scheduled and serviced per second.
+ *
+ * Build it against gem5 libraries with and without the event queue
+ * timing wheel (USE_EVENTQ_TIMING_WHEEL) to compare the two.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+std::mt19937_64 rng(0);
+
+class PeriodicEvent : public Event
+{
+  private:
+    EventQueue &queue;
+    const Tick period;
+
+  public:
+    PeriodicEvent(EventQueue &q, Tick p, Priority prio)
+        : Event(prio), queue(q), period(p)
+    {}
+
+    void process() override { queue.schedule(this, when() + period); }
+};
+
+class OneShotEvent : public Event
+{
+  private:
+    EventQueue &queue;
+    const Tick minLatency;
+    const Tick maxLatency;
+
+  public:
+    OneShotEvent(EventQueue &q, Tick min_lat, Tick max_lat)
+        : queue(q), minLatency(min_lat), maxLatency(max_lat)
+    {}
+
+    void
+    process() override
+    {
+        queue.schedule(this, when() + minLatency +
+                       rng() % (maxLatency - minLatency + 1));
+    }
+};
+
+void
+usage(const char *name)
+{
+    std::cerr << "Usage: " << name << " [periodic [oneshot [events]]]\n"
+              << "  periodic  Number of periodic events (default: 1000)\n"
+              << "  oneshot   Number of one-shot events (default: 10000)\n"
+              << "  events    Number of events to service "
+              << "(default: 10000000)\n";
+    std::exit(1);
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char **argv)
+{
+    if (argc > 4)
+        usage(argv[0]);
+
+    const unsigned num_periodic = argc > 1 ? std::atoi(argv[1]) : 1000;
+    const unsigned num_oneshot = argc > 2 ? std::atoi(argv[2]) : 10000;
+    const uint64_t num_events = argc > 3 ? std::atoll(argv[3]) : 10000000;
+
+    EventQueue queue("bench");
+    curEventQueue(&queue);
+
+    // Clock periods (in ps) of the periodic events, e.g., CPUs, caches,
+    // memory controllers and the interconnect.
+    const Tick periods[] = { 250, 333, 500, 1000 };
+    const Event::Priority priorities[] = {
+        Event::CPU_Tick_Pri, Event::Default_Pri, Event::Default_Pri - 1,
+    };
+
+    std::vector<std::unique_ptr<Event>> events;
+    for (unsigned i = 0; i < num_periodic; ++i) {
+        const Tick period = periods[rng() % 4];
+        auto *event = new PeriodicEvent(
+            queue, period, priorities[rng() % 3]);
+        events.emplace_back(event);
+        queue.schedule(event, rng() % period);
+    }
+    for (unsigned i = 0; i < num_oneshot; ++i) {
+        // Memory latencies between 10ns and 200ns
+        auto *event = new OneShotEvent(queue, 10000, 200000);
+        events.emplace_back(event);
+        queue.schedule(event, rng() % 200000);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < num_events; ++i)
+        queue.serviceOne();
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    std::cout << "periodic: " << num_periodic
+              << " oneshot: " << num_oneshot
+              << " events: " << num_events
+              << " time: " << elapsed.count() << "s"
+              << " rate: " << num_events / elapsed.count() / 1e6
+              << " Mevents/s\n";
+
+    for (auto &event : events)
+        queue.deschedule(event.get());
+
+    return 0;
+}
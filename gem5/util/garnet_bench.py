@@ -0,0 +1,129 @@
+#! /usr/bin/env python3
+# Copyright (c) 2026
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+# This script measures how fast garnet simulates, in flits delivered per
+# host second, using the garnet_synth_traffic.py example script on a mesh
+# for a range of injection rates. Low injection rates show the cost of
+# waking up routers which have little to do.
+#
+# With --analytic, every rate is also run with the analytic network model,
+# and the speedup and the error of its average packet latency relative to
+# the detailed model are reported.
+#
+# Usage: util/garnet_bench.py build/NULL/gem5.opt -i 0.01 0.05 0.1
+
+parser = argparse.ArgumentParser()
+parser.add_argument("binary")
+parser.add_argument(
+    "-i", "--injectionrates", type=float, nargs="+", default=[0.01, 0.1, 0.3]
+)
+parser.add_argument("--sim-cycles", type=int, default=100000)
+parser.add_argument("--mesh-rows", type=int, default=8)
+parser.add_argument("--synthetic", default="uniform_random")
+parser.add_argument("--threads", type=int, default=0)
+parser.add_argument("--analytic", action="store_true")
+
+args = parser.parse_args()
+
+num_nodes = args.mesh_rows * args.mesh_rows
+
+
+def stat(stats, name):
+    match = re.search(rf"^{re.escape(name)}\s+(\S+)", stats, re.MULTILINE)
+    if not match:
+        print(f"Error: {name} not found in the stats")
+        sys.exit(1)
+    return float(match.group(1))
+
+
+def run(rate, extra_args=()):
+    with tempfile.TemporaryDirectory() as outdir:
+        status = subprocess.call(
+            [
+                args.binary,
+                "-q",
+                f"--outdir={outdir}",
+                "configs/example/garnet_synth_traffic.py",
+                "--network=garnet",
+                "--topology=Mesh_XY",
+                f"--mesh-rows={args.mesh_rows}",
+                f"--num-cpus={num_nodes}",
+                f"--num-dirs={num_nodes}",
+                f"--synthetic={args.synthetic}",
+                f"--injectionrate={rate}",
+                f"--sim-cycles={args.sim_cycles}",
+                f"--garnet-threads={args.threads}",
+            ]
+            + list(extra_args),
+            stdout=subprocess.DEVNULL,
+        )
+        if status != 0:
+            print("Error: garnet_synth_traffic run failed")
+            sys.exit(1)
+        with open(os.path.join(outdir, "stats.txt")) as f:
+            stats = f.read()
+
+    return (
+        stat(stats, "system.ruby.network.flits_received::total"),
+        stat(stats, "hostSeconds"),
+        stat(stats, "system.ruby.network.average_packet_latency"),
+    )
+
+
+header = f"{'rate':>8} {'flits':>12} {'host s':>10} {'flits/host s':>14}"
+if args.analytic:
+    header += f" {'speedup':>8} {'latency error':>14}"
+print(header)
+
+max_error = 0
+for rate in args.injectionrates:
+    flits, host_seconds, latency = run(rate)
+    line = (
+        f"{rate:>8} {flits:>12.0f} {host_seconds:>10.2f} "
+        f"{flits / host_seconds:>14.0f}"
+    )
+    if args.analytic:
+        _, analytic_seconds, analytic_latency = run(
+            rate, ["--garnet-analytic"]
+        )
+        error = (analytic_latency - latency) / latency
+        max_error = max(max_error, abs(error))
+        line += (
+            f" {host_seconds / analytic_seconds:>8.1f}"
+            f" {error * 100:>13.1f}%"
+        )
+    print(line)
+
+if args.analytic:
+    print(f"Largest latency error: {max_error * 100:.1f}%")